@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2025 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <benchmark/benchmark.h>
+#include <string>
+#include <tyr/tyr.hpp>
+#include <vector>
+
+namespace b = tyr::buffer;
+namespace f = tyr::formalism;
+
+namespace tyr::benchmarks
+{
+
+static std::vector<Data<f::Predicate<f::FluentTag>>> create_predicates(size_t num_predicates)
+{
+    auto predicates = std::vector<Data<f::Predicate<f::FluentTag>>>(num_predicates);
+    for (size_t i = 0; i < num_predicates; ++i)
+    {
+        auto& builder = predicates[i];
+        builder.index.value = i;
+        builder.name = "predicate_" + std::to_string(i);
+        builder.arity = i % 4;
+        canonicalize(builder);
+    }
+    return predicates;
+}
+
+/// @brief Insert `state.range(0)` unique elements into a cleared set.
+static void BM_IndexedHashSetInsertUnique(benchmark::State& state)
+{
+    const auto predicates = create_predicates(state.range(0));
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        auto arena = b::SegmentedBuffer();
+        auto buffer = b::Buffer();
+        auto repository = b::IndexedHashSet<f::Predicate<f::FluentTag>>(buffer, arena);
+        state.ResumeTiming();
+
+        for (const auto& predicate : predicates)
+            benchmark::DoNotOptimize(repository.insert(predicate));
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/// @brief Insert `state.range(0)` elements that are already contained in the set.
+static void BM_IndexedHashSetInsertExisting(benchmark::State& state)
+{
+    const auto predicates = create_predicates(state.range(0));
+
+    auto arena = b::SegmentedBuffer();
+    auto buffer = b::Buffer();
+    auto repository = b::IndexedHashSet<f::Predicate<f::FluentTag>>(buffer, arena);
+    for (const auto& predicate : predicates)
+        repository.insert(predicate);
+
+    for (auto _ : state)
+        for (const auto& predicate : predicates)
+            benchmark::DoNotOptimize(repository.insert(predicate));
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_IndexedHashSetInsertUnique)->RangeMultiplier(8)->Range(1 << 6, 1 << 15);
+BENCHMARK(BM_IndexedHashSetInsertExisting)->RangeMultiplier(8)->Range(1 << 6, 1 << 15);
+
+}
@@ -0,0 +1,85 @@
+/*
+ * Copyright (C) 2025 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <benchmark/benchmark.h>
+#include <tyr/common/bit_packed_array_pool.hpp>
+#include <tyr/common/config.hpp>
+#include <vector>
+
+namespace tyr::benchmarks
+{
+
+static constexpr size_t ARRAY_LENGTH = 32;
+static constexpr uint8_t ARRAY_WIDTH = 7;
+
+using Pool = BitPackedArrayPool<uint_t, bit::ForwardingBlockCoder<uint_t>>;
+
+static std::vector<std::vector<uint_t>> create_arrays(size_t num_arrays)
+{
+    auto arrays = std::vector<std::vector<uint_t>>(num_arrays, std::vector<uint_t>(ARRAY_LENGTH));
+    for (size_t i = 0; i < num_arrays; ++i)
+        for (size_t j = 0; j < ARRAY_LENGTH; ++j)
+            arrays[i][j] = (i * 31 + j * 7) % (uint_t(1) << ARRAY_WIDTH);
+    return arrays;
+}
+
+/// @brief Append `state.range(0)` arrays to a cleared pool.
+static void BM_BitPackedArrayPoolPushBack(benchmark::State& state)
+{
+    const auto arrays = create_arrays(state.range(0));
+    auto pool = Pool(ARRAY_LENGTH, ARRAY_WIDTH);
+
+    for (auto _ : state)
+    {
+        pool.clear();
+        for (const auto& array : arrays)
+            pool.push_back(array);
+        benchmark::DoNotOptimize(pool.size());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/// @brief Read every element of `state.range(0)` arrays.
+static void BM_BitPackedArrayPoolAccess(benchmark::State& state)
+{
+    const auto arrays = create_arrays(state.range(0));
+    auto pool = Pool(ARRAY_LENGTH, ARRAY_WIDTH);
+    for (const auto& array : arrays)
+        pool.push_back(array);
+
+    const auto& const_pool = pool;
+
+    for (auto _ : state)
+    {
+        auto sum = uint_t(0);
+        for (size_t i = 0; i < const_pool.size(); ++i)
+        {
+            const auto view = const_pool[i];
+            for (size_t j = 0; j < ARRAY_LENGTH; ++j)
+                sum += view[j];
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0) * ARRAY_LENGTH);
+}
+
+BENCHMARK(BM_BitPackedArrayPoolPushBack)->RangeMultiplier(8)->Range(1 << 6, 1 << 15);
+BENCHMARK(BM_BitPackedArrayPoolAccess)->RangeMultiplier(8)->Range(1 << 6, 1 << 15);
+
+}
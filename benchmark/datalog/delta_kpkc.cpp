@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2025 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "utils.hpp"
+
+#include <benchmark/benchmark.h>
+#include <tyr/datalog/assignment_sets.hpp>
+#include <tyr/datalog/delta_kpkc.hpp>
+#include <tyr/datalog/fact_sets.hpp>
+#include <vector>
+
+namespace d = tyr::datalog;
+namespace f = tyr::formalism;
+
+namespace tyr::benchmarks
+{
+
+/// @brief Replay two semi-naive iterations of every rule in the grounding program of instance `state.range(0)`.
+///
+/// The fluent facts at the fixpoint are split into two halves.
+/// The first iteration sees the first half as its delta and the second iteration sees the second half,
+/// such that `for_each_new_k_clique` in the second iteration enumerates exactly the cliques that touch a new fact.
+static void BM_DeltaKPKCForEachNewKClique(benchmark::State& state)
+{
+    const auto lifted_task = compute_lifted_task(get_instances().at(state.range(0)));
+    const auto fixture = std::make_unique<SolvedGroundProgram>(lifted_task);
+    const auto& workspace = fixture->workspace;
+    const auto& const_workspace = fixture->const_workspace;
+
+    const auto bindings = fixture->get_bindings();
+
+    auto first_delta = workspace.facts.fact_sets;
+    auto second_delta = workspace.facts.fact_sets;
+    first_delta.reset();
+    second_delta.reset();
+    for (size_t i = 0; i < bindings.size(); ++i)
+        ((i % 2 == 0) ? first_delta : second_delta).predicate.insert(bindings[i]);
+
+    auto first_assignment_sets = workspace.facts.assignment_sets;
+    first_assignment_sets.reset();
+    first_assignment_sets.insert(first_delta);
+    const auto& second_assignment_sets = workspace.facts.assignment_sets;
+
+    const auto& static_assignment_sets = const_workspace.facts.assignment_sets;
+
+    auto algorithms = std::vector<d::kpkc::DeltaKPKC> {};
+    auto kpkc_workspaces = std::vector<d::kpkc::Workspace> {};
+    for (const auto& rule : const_workspace.rules)
+    {
+        const auto& algorithm = algorithms.emplace_back(rule.get_static_consistency_graph());
+        kpkc_workspaces.emplace_back(algorithm.get_graph_layout());
+    }
+
+    size_t num_cliques = 0;
+
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < algorithms.size(); ++i)
+        {
+            const auto& static_graph = const_workspace.rules[i].get_static_consistency_graph();
+            auto& algorithm = algorithms[i];
+
+            algorithm.reset();
+            algorithm.set_next_assignment_sets(static_graph, first_delta, d::AssignmentSets(static_assignment_sets, first_assignment_sets));
+            algorithm.set_next_assignment_sets(static_graph, second_delta, d::AssignmentSets(static_assignment_sets, second_assignment_sets));
+            algorithm.for_each_new_k_clique([&](auto&&) { ++num_cliques; }, kpkc_workspaces[i]);
+        }
+    }
+
+    benchmark::DoNotOptimize(num_cliques);
+    state.counters["rules"] = algorithms.size();
+    state.counters["cliques"] = benchmark::Counter(num_cliques, benchmark::Counter::kAvgIterations);
+}
+
+BENCHMARK(BM_DeltaKPKCForEachNewKClique)->DenseRange(0, 5)->Unit(benchmark::kMicrosecond);
+
+}
@@ -0,0 +1,141 @@
+/*
+ * Copyright (C) 2025 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "utils.hpp"
+
+#include <benchmark/benchmark.h>
+#include <tyr/datalog/assignment.hpp>
+#include <tyr/datalog/assignment_sets.hpp>
+#include <tyr/datalog/fact_sets.hpp>
+#include <vector>
+
+namespace d = tyr::datalog;
+namespace f = tyr::formalism;
+
+namespace tyr::benchmarks
+{
+
+struct Assignments
+{
+    std::vector<std::pair<Index<f::Predicate<f::FluentTag>>, d::VertexAssignment>> vertices;
+    std::vector<std::pair<Index<f::Predicate<f::FluentTag>>, d::EdgeAssignment>> edges;
+};
+
+static Assignments collect_assignments(const std::vector<formalism::datalog::PredicateBindingView<f::FluentTag>>& bindings)
+{
+    auto assignments = Assignments {};
+    for (const auto binding : bindings)
+    {
+        const auto predicate = binding.get_index().relation;
+        const auto objects = binding.get_objects();
+        const auto arity = binding.get_relation().get_arity();
+
+        for (uint_t first_index = 0; first_index < arity; ++first_index)
+        {
+            assignments.vertices.emplace_back(predicate, d::VertexAssignment(f::ParameterIndex(first_index), objects[first_index].get_index()));
+
+            for (uint_t second_index = first_index + 1; second_index < arity; ++second_index)
+                assignments.edges.emplace_back(predicate,
+                                               d::EdgeAssignment(f::ParameterIndex(first_index),
+                                                                 objects[first_index].get_index(),
+                                                                 f::ParameterIndex(second_index),
+                                                                 objects[second_index].get_index()));
+        }
+    }
+    return assignments;
+}
+
+/// @brief Insert all fluent bindings at the fixpoint of the grounding program of instance `state.range(0)` into cleared fact sets.
+static void BM_PredicateFactSetsInsert(benchmark::State& state)
+{
+    const auto lifted_task = compute_lifted_task(get_instances().at(state.range(0)));
+    const auto fixture = std::make_unique<SolvedGroundProgram>(lifted_task);
+    const auto bindings = fixture->get_bindings();
+
+    auto fact_sets = fixture->workspace.facts.fact_sets.predicate;
+
+    for (auto _ : state)
+    {
+        fact_sets.reset();
+        for (const auto binding : bindings)
+            fact_sets.insert(binding);
+    }
+
+    state.SetItemsProcessed(state.iterations() * bindings.size());
+}
+
+/// @brief Test membership of all fluent bindings at the fixpoint of the grounding program of instance `state.range(0)`.
+static void BM_PredicateFactSetsContains(benchmark::State& state)
+{
+    const auto lifted_task = compute_lifted_task(get_instances().at(state.range(0)));
+    const auto fixture = std::make_unique<SolvedGroundProgram>(lifted_task);
+    const auto bindings = fixture->get_bindings();
+
+    const auto& fact_sets = fixture->workspace.facts.fact_sets.predicate;
+
+    for (auto _ : state)
+        for (const auto binding : bindings)
+            benchmark::DoNotOptimize(fact_sets.contains(binding));
+
+    state.SetItemsProcessed(state.iterations() * bindings.size());
+}
+
+/// @brief Insert all fluent bindings at the fixpoint of the grounding program of instance `state.range(0)` into cleared assignment sets.
+static void BM_PredicateAssignmentSetsInsert(benchmark::State& state)
+{
+    const auto lifted_task = compute_lifted_task(get_instances().at(state.range(0)));
+    const auto fixture = std::make_unique<SolvedGroundProgram>(lifted_task);
+    const auto bindings = fixture->get_bindings();
+
+    auto assignment_sets = fixture->workspace.facts.assignment_sets.predicate;
+
+    for (auto _ : state)
+    {
+        assignment_sets.reset();
+        for (const auto binding : bindings)
+            assignment_sets.insert(binding);
+    }
+
+    state.SetItemsProcessed(state.iterations() * bindings.size());
+}
+
+/// @brief Look up all vertex and edge assignments induced by the fluent bindings of instance `state.range(0)`.
+static void BM_PredicateAssignmentSetsLookup(benchmark::State& state)
+{
+    const auto lifted_task = compute_lifted_task(get_instances().at(state.range(0)));
+    const auto fixture = std::make_unique<SolvedGroundProgram>(lifted_task);
+    const auto assignments = collect_assignments(fixture->get_bindings());
+
+    const auto& assignment_sets = fixture->workspace.facts.assignment_sets.predicate;
+
+    for (auto _ : state)
+    {
+        for (const auto& [predicate, assignment] : assignments.vertices)
+            benchmark::DoNotOptimize(assignment_sets.get_set(predicate)[assignment]);
+        for (const auto& [predicate, assignment] : assignments.edges)
+            benchmark::DoNotOptimize(assignment_sets.get_set(predicate)[assignment]);
+    }
+
+    state.SetItemsProcessed(state.iterations() * (assignments.vertices.size() + assignments.edges.size()));
+}
+
+BENCHMARK(BM_PredicateFactSetsInsert)->DenseRange(0, 5);
+BENCHMARK(BM_PredicateFactSetsContains)->DenseRange(0, 5);
+BENCHMARK(BM_PredicateAssignmentSetsInsert)->DenseRange(0, 5);
+BENCHMARK(BM_PredicateAssignmentSetsLookup)->DenseRange(0, 5);
+
+}
@@ -0,0 +1,59 @@
+/*
+ * Copyright (C) 2025 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "utils.hpp"
+
+#include <benchmark/benchmark.h>
+#include <vector>
+
+namespace fp = tyr::formalism::planning;
+namespace p = tyr::planning;
+
+namespace tyr::benchmarks
+{
+
+static constexpr size_t NUM_MATCH_TREE_STATES = 256;
+
+/// @brief Generate the applicable action candidates of up to `NUM_MATCH_TREE_STATES` reachable states of instance `state.range(0)`.
+static void BM_MatchTreeGenerate(benchmark::State& state)
+{
+    const auto task = compute_ground_task(get_instances().at(state.range(0)));
+    auto successor_generator = p::SuccessorGenerator<p::GroundTask>(task, ExecutionContext::create(1));
+    const auto nodes = collect_nodes(successor_generator, NUM_MATCH_TREE_STATES);
+
+    auto& match_tree = *task->get_action_match_tree();
+    auto applicable_actions = IndexList<fp::GroundAction> {};
+    size_t num_candidates = 0;
+
+    for (auto _ : state)
+    {
+        for (const auto& node : nodes)
+        {
+            match_tree.generate(p::StateContext<p::GroundTask>(*task, node.get_state().get_unpacked_state(), node.get_metric()), applicable_actions);
+            num_candidates += applicable_actions.size();
+        }
+    }
+
+    benchmark::DoNotOptimize(num_candidates);
+    state.SetItemsProcessed(state.iterations() * nodes.size());
+    state.counters["actions"] = task->get_num_actions();
+    state.counters["candidates"] = benchmark::Counter(num_candidates, benchmark::Counter::kAvgIterations);
+}
+
+BENCHMARK(BM_MatchTreeGenerate)->DenseRange(0, 5)->Unit(benchmark::kMicrosecond);
+
+}
@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2025 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "utils.hpp"
+
+#include <benchmark/benchmark.h>
+#include <tyr/planning/applicability.hpp>
+#include <vector>
+
+namespace f = tyr::formalism;
+namespace fp = tyr::formalism::planning;
+namespace p = tyr::planning;
+
+namespace tyr::benchmarks
+{
+
+static const auto NUMERIC_INSTANCE = Instance { "zenotravel/numeric/domain.pddl", "zenotravel/numeric/test_problem.pddl" };
+
+/// @brief Evaluate the numeric constraints and numeric effects of all ground actions in `state.range(0)` reachable states.
+static void BM_NumericEvaluate(benchmark::State& state)
+{
+    const auto task = compute_ground_task(NUMERIC_INSTANCE);
+    auto successor_generator = p::SuccessorGenerator<p::GroundTask>(task, ExecutionContext::create(1));
+    const auto nodes = collect_nodes(successor_generator, state.range(0));
+
+    auto constraints = std::vector<fp::GroundBooleanOperatorView> {};
+    auto effects = std::vector<fp::GroundNumericEffectOperatorView<f::FluentTag>> {};
+    for (const auto action : task->get_task().get_ground_actions())
+    {
+        for (const auto constraint : action.get_condition().get_numeric_constraints())
+            constraints.push_back(constraint);
+        for (const auto cond_effect : action.get_effects())
+            for (const auto effect : cond_effect.get_effect().get_numeric_effects())
+                effects.push_back(effect);
+    }
+
+    for (auto _ : state)
+    {
+        for (const auto& node : nodes)
+        {
+            const auto state_context = p::StateContext<p::GroundTask>(*task, node.get_state().get_unpacked_state(), node.get_metric());
+
+            for (const auto constraint : constraints)
+                benchmark::DoNotOptimize(p::evaluate(constraint, state_context));
+            for (const auto effect : effects)
+                benchmark::DoNotOptimize(p::evaluate(effect, state_context));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * nodes.size() * (constraints.size() + effects.size()));
+}
+
+BENCHMARK(BM_NumericEvaluate)->RangeMultiplier(4)->Range(1 << 4, 1 << 10)->Unit(benchmark::kMicrosecond);
+
+}
@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2025 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "utils.hpp"
+
+#include <benchmark/benchmark.h>
+#include <vector>
+
+namespace p = tyr::planning;
+
+namespace tyr::benchmarks
+{
+
+static const auto STATE_REPOSITORY_INSTANCE = Instance { "visitall/domain.pddl", "visitall/instance2.pddl" };
+
+/// @brief Register `state.range(0)` reachable states in a fresh repository with storage policy `state.range(1)`.
+static void BM_StateRepositoryRegisterState(benchmark::State& state)
+{
+    const auto task = compute_ground_task(STATE_REPOSITORY_INSTANCE);
+    const auto storage_policy = static_cast<p::StateStoragePolicy>(state.range(1));
+    auto successor_generator = p::SuccessorGenerator<p::GroundTask>(task, ExecutionContext::create(1));
+    const auto nodes = collect_nodes(successor_generator, state.range(0));
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        auto repository = p::StateRepository<p::GroundTask>::create(task, ExecutionContext::create(1), storage_policy);
+        state.ResumeTiming();
+
+        for (const auto& node : nodes)
+        {
+            auto unpacked_state = repository->get_unregistered_state();
+            unpacked_state->assign_unextended_part(node.get_state().get_unpacked_state());
+            benchmark::DoNotOptimize(repository->register_state(std::move(unpacked_state)));
+        }
+
+        state.PauseTiming();
+        repository.reset();
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(state.iterations() * nodes.size());
+}
+
+/// @brief Unpack `state.range(0)` registered states from a repository with storage policy `state.range(1)`.
+static void BM_StateRepositoryGetRegisteredState(benchmark::State& state)
+{
+    const auto task = compute_ground_task(STATE_REPOSITORY_INSTANCE);
+    const auto storage_policy = static_cast<p::StateStoragePolicy>(state.range(1));
+    auto successor_generator = p::SuccessorGenerator<p::GroundTask>(task, ExecutionContext::create(1));
+    const auto nodes = collect_nodes(successor_generator, state.range(0));
+
+    auto repository = p::StateRepository<p::GroundTask>::create(task, ExecutionContext::create(1), storage_policy);
+    auto state_indices = std::vector<Index<p::State<p::GroundTask>>> {};
+    for (const auto& node : nodes)
+    {
+        auto unpacked_state = repository->get_unregistered_state();
+        unpacked_state->assign_unextended_part(node.get_state().get_unpacked_state());
+        state_indices.push_back(repository->register_state(std::move(unpacked_state)).get_index());
+    }
+
+    for (auto _ : state)
+        for (const auto state_index : state_indices)
+            benchmark::DoNotOptimize(repository->get_registered_state(state_index));
+
+    state.SetItemsProcessed(state.iterations() * state_indices.size());
+    state.counters["memory"] = repository->memory_usage();
+}
+
+static void StateRepositoryArguments(benchmark::internal::Benchmark* benchmark)
+{
+    for (const auto storage_policy : { p::StateStoragePolicy::TREE_COMPRESSION, p::StateStoragePolicy::HASH_SET })
+        for (int64_t num_states = 1 << 6; num_states <= (1 << 12); num_states <<= 2)
+            benchmark->Args({ num_states, static_cast<int64_t>(storage_policy) });
+}
+
+BENCHMARK(BM_StateRepositoryRegisterState)->Apply(StateRepositoryArguments)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_StateRepositoryGetRegisteredState)->Apply(StateRepositoryArguments)->Unit(benchmark::kMicrosecond);
+
+}
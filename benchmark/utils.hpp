@@ -0,0 +1,141 @@
+/*
+ * Copyright (C) 2025 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef TYR_BENCHMARK_UTILS_HPP_
+#define TYR_BENCHMARK_UTILS_HPP_
+
+#include <deque>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <tyr/datalog/bottom_up.hpp>
+#include <tyr/datalog/contexts/program.hpp>
+#include <tyr/datalog/policies/annotation.hpp>
+#include <tyr/datalog/policies/termination.hpp>
+#include <tyr/datalog/workspaces/program.hpp>
+#include <tyr/formalism/formalism.hpp>
+#include <tyr/planning/planning.hpp>
+#include <tyr/planning/programs/ground.hpp>
+#include <vector>
+
+namespace tyr::benchmarks
+{
+
+/// @brief A domain and problem file relative to the data directory.
+struct Instance
+{
+    std::string domain;
+    std::string problem;
+};
+
+inline std::filesystem::path absolute(const std::string& subdir) { return std::filesystem::path(std::string(DATA_DIR)) / subdir; }
+
+/// @brief Classical instances ordered by increasing size of the ground task.
+/// Benchmarks that are parameterized by instance use the position in this list as their size argument.
+inline const std::vector<Instance>& get_instances()
+{
+    static const auto instances = std::vector<Instance> {
+        { "gripper/domain.pddl", "gripper/p-1-0.pddl" },       { "gripper/domain.pddl", "gripper/p-2-0.pddl" },
+        { "blocks_4/domain.pddl", "blocks_4/test_problem.pddl" }, { "logistics/domain.pddl", "logistics/test_problem.pddl" },
+        { "visitall/domain.pddl", "visitall/instance2.pddl" }, { "rovers/domain.pddl", "rovers/test_problem.pddl" },
+    };
+    return instances;
+}
+
+inline planning::LiftedTask compute_lifted_task(const Instance& instance)
+{
+    return planning::LiftedTask(formalism::planning::Parser(absolute(instance.domain)).parse_task(absolute(instance.problem)));
+}
+
+inline planning::GroundTaskPtr compute_ground_task(const Instance& instance)
+{
+    auto execution_context = ExecutionContext(1);
+    return compute_lifted_task(instance).instantiate_ground_task(execution_context);
+}
+
+/// @brief Collect up to `max_num_nodes` distinct nodes in breadth-first order.
+inline std::vector<planning::Node<planning::GroundTask>> collect_nodes(planning::SuccessorGenerator<planning::GroundTask>& successor_generator,
+                                                                       size_t max_num_nodes)
+{
+    auto nodes = std::vector<planning::Node<planning::GroundTask>> {};
+    auto queue = std::deque<planning::Node<planning::GroundTask>> {};
+    auto seen = UnorderedSet<Index<planning::State<planning::GroundTask>>> {};
+
+    const auto initial_node = successor_generator.get_initial_node();
+    seen.insert(initial_node.get_state().get_index());
+    queue.push_back(initial_node);
+
+    auto successors = std::vector<planning::LabeledNode<planning::GroundTask>> {};
+
+    while (!queue.empty() && nodes.size() < max_num_nodes)
+    {
+        const auto node = queue.front();
+        queue.pop_front();
+        nodes.push_back(node);
+
+        successor_generator.get_labeled_successor_nodes(node, successors);
+        for (const auto& successor : successors)
+            if (seen.insert(successor.node.get_state().get_index()).second)
+                queue.push_back(successor.node);
+    }
+
+    return nodes;
+}
+
+/// @brief The grounding program of a task solved to its fixpoint.
+/// Datalog benchmarks read the final fact sets and consistency graphs from it.
+struct SolvedGroundProgram
+{
+    using Workspace = datalog::ProgramWorkspace<datalog::NoOrAnnotationPolicy, datalog::NoAndAnnotationPolicy, datalog::NoTerminationPolicy>;
+
+    planning::GroundTaskProgram program;
+    datalog::ConstProgramWorkspace const_workspace;
+    Workspace workspace;
+
+    explicit SolvedGroundProgram(const planning::LiftedTask& lifted_task) :
+        program(lifted_task.get_task()),
+        const_workspace(program.get_program_context()),
+        workspace(program.get_program_context(),
+                  const_workspace,
+                  datalog::NoOrAnnotationPolicy(),
+                  datalog::NoAndAnnotationPolicy(),
+                  datalog::NoTerminationPolicy())
+    {
+        auto ctx = datalog::ProgramExecutionContext(workspace, const_workspace);
+        ctx.clear();
+        datalog::solve_bottom_up(ctx);
+    }
+
+    SolvedGroundProgram(const SolvedGroundProgram& other) = delete;
+    SolvedGroundProgram& operator=(const SolvedGroundProgram& other) = delete;
+    SolvedGroundProgram(SolvedGroundProgram&& other) = delete;
+    SolvedGroundProgram& operator=(SolvedGroundProgram&& other) = delete;
+
+    /// @brief All fluent bindings derived by the program.
+    std::vector<formalism::datalog::PredicateBindingView<formalism::FluentTag>> get_bindings() const
+    {
+        auto bindings = std::vector<formalism::datalog::PredicateBindingView<formalism::FluentTag>> {};
+        for (const auto& set : workspace.facts.fact_sets.predicate.get_sets())
+            for (const auto binding : set.get_bindings())
+                bindings.push_back(binding);
+        return bindings;
+    }
+};
+
+}
+
+#endif
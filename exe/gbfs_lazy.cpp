@@ -29,13 +29,32 @@ int main(int argc, char** argv)
     program.add_argument("-D", "--domain-filepath").required().help("The path to the PDDL domain file.");
     program.add_argument("-P", "--problem-filepath").required().help("The path to the PDDL problem file.");
     program.add_argument("-O", "--plan-filepath").default_value(std::string("plan.out")).help("The path to the output plan file.");
+    program.add_argument("-M", "--max-memory-mb")
+        .default_value(size_t(0))
+        .scan<'u', size_t>()
+        .help("The memory limit of the search in megabytes. Defaults to no limit.");
     program.add_argument("-N", "--num-worker-threads").default_value(size_t(1)).scan<'u', size_t>().help("The number of worker threads.");
     program.add_argument("-R", "--random-seed").default_value(uint64_t(0)).scan<'u', uint64_t>().help("The random seed.");
     program.add_argument("-S", "--shuffle-labeled-succ-nodes").default_value(false).implicit_value(true).help("Toggle shuffling the labeled successor nodes.");
+    program.add_argument("-T", "--state-storage")
+        .default_value(std::string("tree"))
+        .choices("tree", "hashset")
+        .help("The state storage policy: memory-lean tree compression or fast hash set.");
     program.add_argument("-V", "--verbosity")
         .default_value(size_t(0))
         .scan<'u', size_t>()
         .help("The verbosity level. Defaults to minimal amount of debug output.");
+    program.add_argument("--trace-filepath")
+        .default_value(std::string(""))
+        .help("The path to a Chrome trace JSON file of the datalog and search phases. Defaults to no tracing.");
+    program.add_argument("--progress-fd")
+        .default_value(int(-1))
+        .scan<'i', int>()
+        .help("The file descriptor to which JSON-lines progress records are written, e.g., 2 for stderr. Defaults to no progress records.");
+    program.add_argument("--progress-interval-ms")
+        .default_value(size_t(1000))
+        .scan<'u', size_t>()
+        .help("The minimum time between two periodic progress records.");
 
     try
     {
@@ -55,14 +74,25 @@ int main(int argc, char** argv)
         auto domain_filepath = program.get<std::string>("--domain-filepath");
         auto problem_filepath = program.get<std::string>("--problem-filepath");
         auto plan_filepath = program.get<std::string>("--plan-filepath");
+        auto max_memory_mb = program.get<std::size_t>("--max-memory-mb");
         auto num_worker_threads = program.get<std::size_t>("--num-worker-threads");
         auto random_seed = program.get<uint64_t>("--random-seed");
         auto shuffle_labeled_succ_nodes = program.get<bool>("--shuffle-labeled-succ-nodes");
         auto verbosity = program.get<size_t>("--verbosity");
+        auto trace_filepath = program.get<std::string>("--trace-filepath");
+        auto progress_fd = program.get<int>("--progress-fd");
+        auto progress_interval = std::chrono::milliseconds(program.get<size_t>("--progress-interval-ms"));
+        auto state_storage_policy = (program.get<std::string>("--state-storage") == "hashset") ? planning::StateStoragePolicy::HASH_SET :
+                                                                                                  planning::StateStoragePolicy::TREE_COMPRESSION;
 
         std::cout << "[INPUT] Num worker threads: " << num_worker_threads << std::endl;
         std::cout << "[INPUT] Random seed: " << random_seed << std::endl;
         std::cout << "[INPUT] Shuffle labeled successor nodes: " << shuffle_labeled_succ_nodes << std::endl;
+        std::cout << "[INPUT] State storage: " << program.get<std::string>("--state-storage") << std::endl;
+        std::cout << "[INPUT] Max memory: " << max_memory_mb << " MB" << std::endl;
+
+        if (!trace_filepath.empty())
+            trace::Tracer::instance().enable();
 
         auto parser_options = loki::ParserOptions();
         // parser_options.strict = true;
@@ -81,18 +111,40 @@ int main(int argc, char** argv)
 
         auto execution_context = ExecutionContext::create(num_worker_threads);
 
-        auto successor_generator = planning::SuccessorGenerator<planning::LiftedTask>(lifted_task, execution_context);
+        auto successor_generator = planning::SuccessorGenerator<planning::LiftedTask>(lifted_task, execution_context, state_storage_policy);
 
         auto options = planning::gbfs_lazy::Options<planning::LiftedTask>();
         options.start_node = successor_generator.get_initial_node();
         options.event_handler = planning::gbfs_lazy::DefaultEventHandler<planning::LiftedTask>::create(verbosity);
         options.random_seed = random_seed;
+        if (max_memory_mb > 0)
+            options.max_memory_bytes = max_memory_mb * 1024 * 1024;
         options.shuffle_labeled_succ_nodes = shuffle_labeled_succ_nodes;
 
         auto ff_heuristic = planning::FFRPGHeuristic<planning::LiftedTask>::create(lifted_task, execution_context);
 
+        if (progress_fd >= 0)
+        {
+            auto probe = [&successor_generator, ff_heuristic]
+            {
+                const auto& state_repository = successor_generator.get_state_repository();
+                auto sample = planning::ProgressSample {};
+                sample.num_states = state_repository->get_num_states();
+                sample.states_memory_usage = state_repository->memory_usage();
+                sample.successor_generator_time = successor_generator.get_workspace().statistics.total_time;
+                sample.axiom_evaluator_time = state_repository->get_axiom_evaluator()->get_workspace().statistics.total_time;
+                sample.heuristic_time = ff_heuristic->get_workspace().statistics.total_time;
+                return sample;
+            };
+            using JsonLinesEventHandler = planning::gbfs_lazy::JsonLinesEventHandler<planning::LiftedTask>;
+            options.event_handler = JsonLinesEventHandler::create(progress_fd, progress_interval, std::move(probe), options.event_handler);
+        }
+
         auto result = planning::gbfs_lazy::find_solution(*lifted_task, successor_generator, *ff_heuristic, options);
 
+        if (result.status == planning::SearchStatus::OUT_OF_MEMORY)
+            std::cout << "[Search] Memory limit reached." << std::endl;
+
         if (result.status == planning::SearchStatus::SOLVED)
         {
             std::ofstream plan_file;
@@ -117,6 +169,10 @@ int main(int argc, char** argv)
             for (const auto& worker : ws_rule->worker)
                 successor_generator_rule_worker_statistics.push_back(worker.solve.statistics);
         std::cout << datalog::compute_aggregated_rule_worker_statistics(successor_generator_rule_worker_statistics) << std::endl;
+        std::cout << successor_generator.get_workspace().get_memory_statistics() << std::endl;
+        std::cout << "[Successor generator] Ground action table: " << successor_generator.get_ground_action_table().size() << " entries, "
+                  << successor_generator.get_ground_action_table().get_num_hits() << " hits, "
+                  << successor_generator.get_ground_action_table().get_num_misses() << " misses" << std::endl;
 
         std::cout << "[Axiom evaluator] Summary" << std::endl;
         std::cout << successor_generator.get_state_repository()->get_axiom_evaluator()->get_workspace().statistics << std::endl;
@@ -129,6 +185,7 @@ int main(int argc, char** argv)
             for (const auto& worker : ws_rule->worker)
                 axiom_evaluator_rule_worker_statistics.push_back(worker.solve.statistics);
         std::cout << datalog::compute_aggregated_rule_worker_statistics(axiom_evaluator_rule_worker_statistics) << std::endl;
+        std::cout << successor_generator.get_state_repository()->get_axiom_evaluator()->get_workspace().get_memory_statistics() << std::endl;
 
         std::cout << "[FFRPGHeuristic] Summary" << std::endl;
         std::cout << ff_heuristic->get_workspace().statistics << std::endl;
@@ -149,6 +206,7 @@ int main(int argc, char** argv)
             for (const auto& worker : ws_rule->worker)
                 ff_heuristic_rule_worker_statistics.push_back(worker.solve.statistics);
         std::cout << datalog::compute_aggregated_rule_worker_statistics(ff_heuristic_rule_worker_statistics) << std::endl;
+        std::cout << ff_heuristic->get_workspace().get_memory_statistics() << std::endl;
 
         std::cout << "[Total] Number of fluent atoms: " << lifted_task->get_repository()->size<formalism::planning::GroundAtom<formalism::FluentTag>>()
                   << std::endl;
@@ -157,6 +215,27 @@ int main(int argc, char** argv)
         std::cout << "[Total] Number of fluent fterms: " << lifted_task->get_repository()->size<formalism::planning::GroundFunctionTerm<formalism::FluentTag>>()
                   << std::endl;
         std::cout << "[Total] States memory usage: " << successor_generator.get_state_repository()->memory_usage() << " bytes" << std::endl;
+        std::cout << "[Memory] Task repository: " << lifted_task->get_repository()->memory_usage() << " bytes" << std::endl;
+        std::cout << "[Memory] Const program workspaces: "
+                  << (lifted_task->get_action_program().get_const_program_workspace().memory_usage()
+                      + lifted_task->get_axiom_program().get_const_program_workspace().memory_usage()
+                      + lifted_task->get_rpg_program().get_const_program_workspace().memory_usage())
+                  << " bytes" << std::endl;
+        std::cout << "[Memory] Search nodes: " << result.search_nodes_memory_usage << " bytes" << std::endl;
+        std::cout << "[Memory] Open list: " << result.openlist_memory_usage << " bytes" << std::endl;
+
+        if (PerfCounterGroup::get_thread_instance().is_available())
+        {
+            std::cout << "[Search] Successor generation counters: " << successor_generator.get_perf_counters() << std::endl;
+            std::cout << "[Search] Register state counters: " << successor_generator.get_state_repository()->get_register_state_perf_counters() << std::endl;
+        }
+
+        if (!trace_filepath.empty())
+        {
+            trace::Tracer::instance().disable();
+            trace::Tracer::instance().write_chrome_trace(trace_filepath);
+            std::cout << "[Total] Trace events: " << trace::Tracer::instance().get_num_events() << std::endl;
+        }
     }
 
     std::cout << "[Total] Peak memory usage: " << get_peak_memory_usage_in_bytes() << " bytes" << std::endl;
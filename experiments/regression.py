@@ -0,0 +1,259 @@
+#! /usr/bin/env python
+
+"""
+Local end-to-end performance regression check over the instances bundled in data/.
+
+Runs the exe targets on every (domain, problem) pair under data/, parses their output,
+writes a JSON report, and compares it against a stored baseline.
+
+Example:
+
+    python experiments/regression.py --build-dir build --output report.json
+    python experiments/regression.py --build-dir build --output report.json --baseline baseline.json
+
+The exit code is 1 if any metric regressed beyond its tolerance, and 0 otherwise.
+"""
+
+import argparse
+import json
+import platform
+import re
+import subprocess
+import sys
+import time
+
+from pathlib import Path
+
+DIR = Path(__file__).resolve().parent
+REPO = DIR.parent
+
+PLANNERS = ["gbfs_lazy", "astar_eager"]
+
+
+RE_SECTION = re.compile(r'^\[(?P<name>[^\]]+)\]\s+Summary$')
+
+SECTION_MAP = {
+    "Successor generator": "succgen",
+    "Axiom evaluator": "axiom",
+    "FFRPGHeuristic": "ff",
+}
+
+SEARCH_PATTERNS = {
+    "cost": (re.compile(r'\[(?:GBFS|ASTAR)\] Plan cost: ([0-9.eE+-]+)'), float),
+    "length": (re.compile(r'\[(?:GBFS|ASTAR)\] Plan length: (\d+)'), int),
+    "search_time_ns": (re.compile(r'\[Search\] Search time: \d+ ms \((\d+) ns\)'), int),
+    "num_expanded": (re.compile(r'\[Search\] Number of expanded states: (\d+)'), int),
+    "num_generated": (re.compile(r'\[Search\] Number of generated states: (\d+)'), int),
+    "total_time_ns": (re.compile(r'\[Total\] Total time: \d+ ms \((\d+) ns\)'), int),
+    "num_fluent_atoms": (re.compile(r'\[Total\] Number of fluent atoms: (\d+)'), int),
+    "num_derived_atoms": (re.compile(r'\[Total\] Number of derived atoms: (\d+)'), int),
+    "states_memory_usage_bytes": (re.compile(r'\[Total\] States memory usage: (\d+) bytes'), int),
+    "peak_memory_usage_bytes": (re.compile(r'\[Total\] Peak memory usage: (\d+) bytes'), int),
+    "task_repository_memory_usage_bytes": (re.compile(r'\[Memory\] Task repository: (\d+) bytes'), int),
+    "search_nodes_memory_usage_bytes": (re.compile(r'\[Memory\] Search nodes: (\d+) bytes'), int),
+    "openlist_memory_usage_bytes": (re.compile(r'\[Memory\] Open list: (\d+) bytes'), int),
+}
+
+# Datalog breakdowns, prefixed by the section in which they occur.
+DATALOG_PATTERNS = {
+    "prog_n_exec": re.compile(r'^\[ProgramStatistics\]\s+N_exec\s*=\s*(\d+)'),
+    "prog_t_tot_ms": re.compile(r'^\[ProgramStatistics\]\s+T_tot\s*=\s*(\d+)\s*ms'),
+    "prog_t_par_ms": re.compile(r'^\[ProgramStatistics\]\s+T_par\s*=\s*(\d+)\s*ms'),
+    "prog_t_avg_us": re.compile(r'^\[ProgramStatistics\]\s+T_avg\s*=\s*(\d+)\s*us'),
+    "rule_n_exec": re.compile(r'^\[AggregatedRuleStatistics\]\s+N_exec\s*=\s*(\d+)'),
+    "rule_t_tot_ms": re.compile(r'^\[AggregatedRuleStatistics\]\s+T_tot\s*=\s*(\d+)\s*ms'),
+    "rule_t_tot_max_ms": re.compile(r'^\[AggregatedRuleStatistics\]\s+T_tot_max\s*=\s*(\d+)\s*ms'),
+    "rule_t_avg_us": re.compile(r'^\[AggregatedRuleStatistics\]\s+T_avg\s*=\s*(\d+)\s*us'),
+    "mem_tot_bytes": re.compile(r'^\[MemoryStatistics\]\s+M_tot\s*=\s*(\d+)\s*B'),
+}
+
+# Metrics compared against the baseline: name -> (higher_is_better, tolerance argument)
+COMPARED_METRICS = {
+    "expansions_per_second": (True, "throughput_tolerance"),
+    "search_time_ns": (False, "time_tolerance"),
+    "total_time_ns": (False, "time_tolerance"),
+    "succgen_prog_t_tot_ms": (False, "time_tolerance"),
+    "axiom_prog_t_tot_ms": (False, "time_tolerance"),
+    "ff_prog_t_tot_ms": (False, "time_tolerance"),
+    "peak_memory_usage_bytes": (False, "memory_tolerance"),
+    "states_memory_usage_bytes": (False, "memory_tolerance"),
+}
+
+
+def collect_instances(data_dir: Path):
+    """ Every directory with a domain.pddl contributes all other .pddl files in it as problems. """
+    instances = []
+    for domain_file in sorted(data_dir.rglob("domain.pddl")):
+        for problem_file in sorted(domain_file.parent.glob("*.pddl")):
+            if problem_file.name == "domain.pddl":
+                continue
+            name = f"{domain_file.parent.relative_to(data_dir).as_posix()}/{problem_file.stem}"
+            instances.append((name, domain_file, problem_file))
+    return instances
+
+
+def parse_output(content: str):
+    props = {}
+
+    for name, (pattern, type) in SEARCH_PATTERNS.items():
+        m = pattern.search(content)
+        if m:
+            props[name] = type(m.group(1))
+
+    section = None
+    for raw in content.splitlines():
+        line = raw.strip()
+
+        m = RE_SECTION.match(line)
+        if m:
+            section = SECTION_MAP.get(m.group("name"))
+            continue
+
+        if not section:
+            continue
+
+        for name, pattern in DATALOG_PATTERNS.items():
+            m = pattern.match(line)
+            if m:
+                props[f"{section}_{name}"] = int(m.group(1))
+                break
+
+    if "search_time_ns" in props and "num_expanded" in props and props["search_time_ns"] > 0:
+        props["expansions_per_second"] = props["num_expanded"] / (props["search_time_ns"] / 1_000_000_000)
+
+    props["solved"] = int("length" in props)
+    props["unsolvable"] = int("Task is unsolvable!" in content)
+
+    return props
+
+
+def run_instance(planner_exe: Path, domain_file: Path, problem_file: Path, plan_file: Path, args):
+    command = [
+        str(planner_exe),
+        "-D", str(domain_file),
+        "-P", str(problem_file),
+        "-O", str(plan_file),
+        "-N", str(args.num_worker_threads),
+        "-T", args.state_storage,
+    ]
+
+    start = time.perf_counter()
+    try:
+        completed = subprocess.run(command, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, text=True, timeout=args.timeout)
+    except subprocess.TimeoutExpired:
+        return {"error": "timeout"}
+    wall_time_s = time.perf_counter() - start
+
+    props = parse_output(completed.stdout)
+    props["wall_time_s"] = wall_time_s
+    if completed.returncode != 0:
+        props["error"] = f"exit code {completed.returncode}"
+    return props
+
+
+def compare(report, baseline, args):
+    """ Return a list of human-readable regressions of `report` relative to `baseline`. """
+    regressions = []
+
+    for key, baseline_props in baseline["runs"].items():
+        props = report["runs"].get(key)
+        if props is None:
+            continue
+
+        if baseline_props.get("solved", 0) and not props.get("solved", 0):
+            regressions.append(f"{key}: no longer solved ({props.get('error', 'no plan')})")
+            continue
+
+        for metric, (higher_is_better, tolerance_name) in COMPARED_METRICS.items():
+            if metric not in props or metric not in baseline_props:
+                continue
+
+            old = baseline_props[metric]
+            new = props[metric]
+            if old <= 0:
+                continue
+
+            tolerance = getattr(args, tolerance_name)
+            change = (new - old) / old
+            worse = -change if higher_is_better else change
+
+            # Ignore noise on runs that are too short to measure reliably.
+            if metric.endswith("_ns") and max(old, new) < args.min_time_ms * 1_000_000:
+                continue
+            if metric.endswith("_ms") and max(old, new) < args.min_time_ms:
+                continue
+
+            if worse > tolerance:
+                regressions.append(f"{key}: {metric} {old:.6g} -> {new:.6g} ({change:+.1%}, tolerance {tolerance:.0%})")
+
+    return regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(description="End-to-end performance regression check over the instances in data/.")
+    parser.add_argument("--build-dir", type=Path, required=True, help="The CMake build directory that contains exe/gbfs_lazy and exe/astar_eager.")
+    parser.add_argument("--data-dir", type=Path, default=REPO / "data", help="The directory with the PDDL instances.")
+    parser.add_argument("--planners", nargs="+", default=PLANNERS, choices=PLANNERS, help="The planners to run.")
+    parser.add_argument("--filter", default=None, help="Only run instances whose name matches this regular expression.")
+    parser.add_argument("--num-worker-threads", type=int, default=1, help="The number of worker threads.")
+    parser.add_argument("--state-storage", default="tree", choices=["tree", "hashset"], help="The state storage policy.")
+    parser.add_argument("--timeout", type=float, default=60.0, help="The time limit per run in seconds.")
+    parser.add_argument("--output", type=Path, default=Path("report.json"), help="The path to the JSON report.")
+    parser.add_argument("--baseline", type=Path, default=None, help="The path to a JSON report to compare against.")
+    parser.add_argument("--throughput-tolerance", type=float, default=0.10, help="Allowed relative decrease of expansions per second.")
+    parser.add_argument("--time-tolerance", type=float, default=0.15, help="Allowed relative increase of times.")
+    parser.add_argument("--memory-tolerance", type=float, default=0.10, help="Allowed relative increase of memory.")
+    parser.add_argument("--min-time-ms", type=float, default=50.0, help="Times below this threshold are not compared.")
+    args = parser.parse_args()
+
+    instances = collect_instances(args.data_dir)
+    if args.filter:
+        instances = [instance for instance in instances if re.search(args.filter, instance[0])]
+
+    plan_file = args.output.with_suffix(".plan")
+
+    report = {
+        "host": platform.node(),
+        "machine": platform.machine(),
+        "num_worker_threads": args.num_worker_threads,
+        "state_storage": args.state_storage,
+        "runs": {},
+    }
+
+    for planner in args.planners:
+        planner_exe = args.build_dir / "exe" / planner
+        if not planner_exe.is_file():
+            print(f"Error: missing planner executable {planner_exe}", file=sys.stderr)
+            return 2
+
+        for name, domain_file, problem_file in instances:
+            key = f"{planner}:{name}"
+            props = run_instance(planner_exe, domain_file, problem_file, plan_file, args)
+            report["runs"][key] = props
+
+            status = props.get("error", "solved" if props.get("solved", 0) else "unsolved")
+            throughput = props.get("expansions_per_second")
+            throughput = f"{throughput:.0f} exp/s" if throughput is not None else "-"
+            print(f"[{planner}] {name}: {status}, {throughput}")
+
+    if plan_file.exists():
+        plan_file.unlink()
+
+    args.output.write_text(json.dumps(report, indent=2, sort_keys=True))
+    print(f"Wrote report to {args.output}")
+
+    if args.baseline is None:
+        return 0
+
+    baseline = json.loads(args.baseline.read_text())
+    regressions = compare(report, baseline, args)
+
+    for regression in regressions:
+        print(f"[Regression] {regression}")
+    print(f"{len(regressions)} regressions relative to {args.baseline}")
+
+    return 1 if regressions else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
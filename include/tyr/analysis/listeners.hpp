@@ -37,6 +37,7 @@ using ListenerStratum = UnorderedMap<Index<formalism::Predicate<formalism::Fluen
 struct ListenerStrata
 {
     std::vector<ListenerStratum> data;
+    std::vector<ListenerStratum> components;  ///< Indexed by component of `RuleStrata::components`.
 };
 
 extern ListenerStrata compute_listeners(const RuleStrata& strata, const formalism::datalog::Repository& context);
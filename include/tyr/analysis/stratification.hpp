@@ -33,6 +33,8 @@ using RuleStratum = IndexList<formalism::datalog::Rule>;
 struct RuleStrata
 {
     std::vector<RuleStratum> data;
+    std::vector<RuleStratum> components;            ///< The rules grouped by the SCC of their head predicate, in topological order.
+    std::vector<std::vector<uint_t>> dependencies;  ///< Indexed by component, the lower components whose derived predicates occur in its rule bodies.
 };
 
 extern RuleStrata compute_rule_stratification(formalism::datalog::ProgramView program);
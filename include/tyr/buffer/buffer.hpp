@@ -18,6 +18,7 @@
 #ifndef TYR_BUFFER_BUFFER_HPP_
 #define TYR_BUFFER_BUFFER_HPP_
 
+#include "tyr/buffer/concurrent_indexed_hash_set.hpp"
 #include "tyr/buffer/declarations.hpp"
 #include "tyr/buffer/indexed_hash_set.hpp"
 #include "tyr/buffer/segmented_buffer.hpp"
@@ -0,0 +1,262 @@
+/*
+ * Copyright (C) 2025 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef TYR_BUFFER_CONCURRENT_INDEXED_HASH_SET_HPP_
+#define TYR_BUFFER_CONCURRENT_INDEXED_HASH_SET_HPP_
+
+#include "cista/serialization.h"
+#include "tyr/buffer/declarations.hpp"
+#include "tyr/buffer/segmented_buffer.hpp"
+#include "tyr/common/bit.hpp"
+#include "tyr/common/config.hpp"
+#include "tyr/common/equal_to.hpp"
+#include "tyr/common/hash.hpp"
+#include "tyr/common/types.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <gtl/phmap.hpp>
+#include <limits>
+#include <memory>
+#include <oneapi/tbb/concurrent_vector.h>
+#include <oneapi/tbb/spin_rw_mutex.h>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace tyr::buffer
+{
+
+/// @brief `ConcurrentIndexedHashSet` is a thread-safe variant of `IndexedHashSet` for concurrent interning.
+///
+/// Elements are distributed over shards by the high bits of their hash. Each shard has its own reader-writer lock,
+/// hash set, arena, and serialization buffer, so that threads inserting into different shards do not contend.
+/// Indices are globally dense: they are allocated from a shared concurrent vector of element pointers when an element is inserted.
+///
+/// `find`, `insert`, and `operator[]` may be called concurrently.
+/// `operator[]` is lock-free and requires that the index was obtained from `find` or `insert`,
+/// or was published to the calling thread with proper synchronization.
+/// `clear` must not run concurrently with any other method.
+template<typename Tag, typename H = Hash<Data<Tag>>, typename E = EqualTo<Data<Tag>>>
+class ConcurrentIndexedHashSet
+{
+private:
+    class IndexableHash;
+    class IndexableEqualTo;
+
+    using VectorType = oneapi::tbb::concurrent_vector<const Data<Tag>*>;
+
+    struct alignas(64) Shard
+    {
+        oneapi::tbb::spin_rw_mutex mutex;
+        gtl::flat_hash_set<Index<Tag>, IndexableHash, IndexableEqualTo> set;
+        SegmentedBuffer arena;
+        Buffer buf;
+
+        explicit Shard(const VectorType& storage) : mutex(), set(0, IndexableHash(storage), IndexableEqualTo(storage)), arena(), buf() {}
+    };
+
+public:
+    /// @param num_shards is the number of shards. It is rounded up to the next power of two.
+    explicit ConcurrentIndexedHashSet(size_t num_shards = 64) :
+        m_storage(std::make_unique<VectorType>()),
+        m_shard_bits(std::countr_zero(std::bit_ceil(std::max(num_shards, size_t(1))))),
+        m_shards()
+    {
+        const auto num_shards_pow2 = size_t(1) << m_shard_bits;
+        m_shards.reserve(num_shards_pow2);
+        for (size_t i = 0; i < num_shards_pow2; ++i)
+            m_shards.push_back(std::make_unique<Shard>(*m_storage));
+    }
+    ConcurrentIndexedHashSet(const ConcurrentIndexedHashSet& other) = delete;
+    ConcurrentIndexedHashSet& operator=(const ConcurrentIndexedHashSet& other) = delete;
+    ConcurrentIndexedHashSet(ConcurrentIndexedHashSet&& other) = default;
+    ConcurrentIndexedHashSet& operator=(ConcurrentIndexedHashSet&& other) = default;
+
+    /**
+     * Capacity
+     */
+
+    bool empty() const noexcept { return m_storage->empty(); }
+
+    /// @brief Return the number of allocated indices, which may include elements whose insertion is still in progress.
+    size_t size() const noexcept { return m_storage->size(); }
+
+    size_t num_shards() const noexcept { return m_shards.size(); }
+
+    /// @brief Unlike `IndexedHashSet`, the arenas are owned by the shards and are included.
+    size_t memory_usage() const noexcept
+    {
+        size_t bytes = m_storage->capacity() * sizeof(const Data<Tag>*);
+        for (const auto& shard : m_shards)
+        {
+            auto lock = oneapi::tbb::spin_rw_mutex::scoped_lock(shard->mutex, false);
+            bytes += sizeof(Shard);
+            bytes += shard->set.capacity() * (sizeof(Index<Tag>) + sizeof(gtl::priv::ctrl_t));
+            bytes += shard->arena.memory_usage();
+            bytes += shard->buf.buf_.capacity();
+        }
+        return bytes;
+    }
+
+    /**
+     * Modifiers
+     */
+
+    void clear()
+    {
+        for (auto& shard : m_shards)
+        {
+            shard->set.clear();
+            shard->arena.clear();
+        }
+        m_storage->clear();
+    }
+
+    static size_t hash(const Data<Tag>& element) noexcept { return gtl::phmap_mix<sizeof(size_t)>()(H {}(element)); }
+
+    std::optional<Index<Tag>> find_with_hash(const Data<Tag>& element, size_t h) const noexcept
+    {
+        assert(is_canonical(element) && "The given element is not canonical. Did you forget to call canonicalize?");
+        assert(h == hash(element) && "The given hash does not match container internal's hash.");
+
+        const auto& shard = get_shard(h);
+        auto lock = oneapi::tbb::spin_rw_mutex::scoped_lock(shard.mutex, false);
+
+        const auto it = shard.set.find(element, h);
+        if (it != shard.set.end())
+            return *it;
+
+        return std::nullopt;
+    }
+
+    std::optional<Index<Tag>> find(const Data<Tag>& element) const noexcept { return find_with_hash(element, ConcurrentIndexedHashSet::hash(element)); }
+
+    /// @brief Insert the element if it does not exist.
+    /// @param h is the hash of the element.
+    /// @param element is the element.
+    /// @return the index of the element and whether it was inserted.
+    template<::cista::mode Mode = CISTA_MODE>
+    std::pair<Index<Tag>, bool> insert_with_hash(size_t h, const Data<Tag>& element)
+    {
+        assert(is_canonical(element) && "The given element is not canonical. Did you forget to call canonicalize?");
+        assert(h == ConcurrentIndexedHashSet::hash(element) && "The given hash does not match container internal's hash.");
+
+        auto& shard = get_shard(h);
+
+        // 1. Check if element already exists, only requiring shared access.
+        auto lock = oneapi::tbb::spin_rw_mutex::scoped_lock(shard.mutex, false);
+
+        auto it = shard.set.find(element, h);
+        if (it != shard.set.end())
+            return std::make_pair(*it, false);
+
+        // 2. Upgrade to exclusive access. If the lock was released temporarily, another thread may have inserted the element.
+        if (!lock.upgrade_to_writer())
+        {
+            it = shard.set.find(element, h);
+            if (it != shard.set.end())
+                return std::make_pair(*it, false);
+        }
+
+        // 3. Allocate a globally dense index.
+        const auto slot = m_storage->grow_by(1);
+        const auto index = Index<Tag>(static_cast<uint_t>(slot - m_storage->begin()));
+
+        // 4. Serialize into the arena of the shard.
+        shard.buf.reset();
+        ::cista::serialize<Mode>(shard.buf, element);
+        auto begin = shard.arena.write(shard.buf.base(), shard.buf.size(), alignof(Data<Tag>));
+
+        // 5. Publish the element pointer before the index becomes visible through the set.
+        *slot = ::cista::deserialize<const Data<Tag>, Mode>(begin, begin + shard.buf.size());
+
+        // 6. Insert into set
+        [[maybe_unused]] auto [it2, inserted] = shard.set.emplace_with_hash(h, index);
+        assert(inserted);
+
+        return std::make_pair(index, true);
+    }
+
+    template<::cista::mode Mode = CISTA_MODE>
+    std::pair<Index<Tag>, bool> insert(const Data<Tag>& element)
+    {
+        return insert_with_hash<Mode>(ConcurrentIndexedHashSet::hash(element), element);
+    }
+
+    /**
+     * Lookup
+     */
+
+    const Data<Tag>& operator[](Index<Tag> index) const noexcept
+    {
+        assert(index.get_value() < m_storage->size());
+        assert((*m_storage)[index.get_value()] && "The element is not yet published.");
+        return *(*m_storage)[index.get_value()];
+    }
+
+private:
+    Shard& get_shard(size_t h) const noexcept
+    {
+        // The low bits select the slot and control byte in the shard's hash set, hence, we use the high bits.
+        const auto shard_index = (m_shard_bits == 0) ? size_t(0) : (h >> (std::numeric_limits<size_t>::digits - m_shard_bits));
+        return *m_shards[shard_index];
+    }
+
+    class IndexableHash
+    {
+    private:
+        const VectorType* m_storage;
+        H m_hash;
+
+    public:
+        using is_transparent = void;
+
+        IndexableHash() noexcept : m_storage(nullptr) {}
+        explicit IndexableHash(const VectorType& storage) noexcept : m_storage(&storage) {}
+
+        size_t operator()(Index<Tag> el) const noexcept { return m_hash(*(*m_storage)[uint_t(el)]); }
+        size_t operator()(const Data<Tag>& el) const noexcept { return m_hash(el); }
+    };
+
+    class IndexableEqualTo
+    {
+    private:
+        const VectorType* m_storage;
+        E m_equal_to;
+
+    public:
+        using is_transparent = void;
+
+        IndexableEqualTo() noexcept : m_storage(nullptr), m_equal_to() {}
+        explicit IndexableEqualTo(const VectorType& storage) noexcept : m_storage(&storage), m_equal_to() {}
+
+        bool operator()(Index<Tag> lhs, Index<Tag> rhs) const noexcept { return m_equal_to(*(*m_storage)[uint_t(lhs)], *(*m_storage)[uint_t(rhs)]); }
+        bool operator()(const Data<Tag>& lhs, Index<Tag> rhs) const noexcept { return m_equal_to(lhs, *(*m_storage)[uint_t(rhs)]); }
+        bool operator()(Index<Tag> lhs, const Data<Tag>& rhs) const noexcept { return m_equal_to(*(*m_storage)[uint_t(lhs)], rhs); }
+        bool operator()(const Data<Tag>& lhs, const Data<Tag>& rhs) const noexcept { return m_equal_to(lhs, rhs); }
+    };
+
+    std::unique_ptr<VectorType> m_storage;
+    size_t m_shard_bits;
+    std::vector<std::unique_ptr<Shard>> m_shards;
+};
+
+}
+
+#endif
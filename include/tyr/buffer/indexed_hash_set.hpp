@@ -65,6 +65,15 @@ public:
     bool empty() const noexcept { return m_storage->empty(); }
     size_t size() const noexcept { return m_storage->size(); }
 
+    /// @brief The serialized elements live in the arena and are accounted for by its owner.
+    size_t memory_usage() const noexcept
+    {
+        size_t bytes = 0;
+        bytes += m_storage ? m_storage->capacity() * sizeof(const Data<Tag>*) : 0;
+        bytes += m_set.capacity() * (sizeof(Index<Tag>) + sizeof(gtl::priv::ctrl_t));
+        return bytes;
+    }
+
     /**
      * Modifiers
      */
@@ -142,6 +151,27 @@ public:
         return insert_with_hash<Mode>(IndexedHashSet::hash(element), element);
     }
 
+    /// @brief Insert an element that is already serialized in memory outliving the container, e.g., a memory-mapped file.
+    /// The element is referenced in place instead of being copied into the arena.
+    std::pair<Index<Tag>, bool> insert_external_with_hash(size_t h, const Data<Tag>& element)
+    {
+        assert(is_canonical(element) && "The given element is not canonical. Did you forget to call canonicalize?");
+        assert(h == IndexedHashSet::hash(element) && "The given hash does not match container internal's hash.");
+
+        auto it = m_set.find(element, h);
+        if (it != m_set.end())
+            return std::make_pair(*it, false);
+
+        const auto index = Index<Tag>(static_cast<uint_t>(m_storage->size()));
+
+        m_storage->push_back(&element);
+
+        [[maybe_unused]] auto [it2, inserted] = m_set.emplace_with_hash(h, index);
+        assert(inserted);
+
+        return std::make_pair(index, true);
+    }
+
     /**
      * Lookup
      */
@@ -19,6 +19,7 @@
 #define TYR_BUFFER_SEGMENTED_BUFFER_HPP_
 
 #include "tyr/common/bit.hpp"
+#include "tyr/common/segment_allocator.hpp"
 
 #include <cassert>
 #include <cstddef>
@@ -31,12 +32,17 @@
 namespace tyr::buffer
 {
 
-class SegmentedBuffer
+/// @brief `BasicSegmentedBuffer` is an append-only arena of geometrically growing segments.
+/// @tparam Allocator allocates the segments.
+template<typename Allocator>
+class BasicSegmentedBuffer
 {
 private:
+    using SegmentType = std::vector<uint8_t, Allocator>;
+
     size_t m_seg_size;
 
-    std::vector<std::vector<uint8_t>> m_segments;
+    std::vector<SegmentType> m_segments;
 
     size_t m_cur_seg;
     size_t m_cur_pos;
@@ -81,7 +87,7 @@ private:
     }
 
 public:
-    explicit SegmentedBuffer(size_t seg_size = 1024) : m_seg_size(seg_size), m_segments(), m_cur_seg(0), m_cur_pos(0), m_size(0), m_capacity(0)
+    explicit BasicSegmentedBuffer(size_t seg_size = 1024) : m_seg_size(seg_size), m_segments(), m_cur_seg(0), m_cur_pos(0), m_size(0), m_capacity(0)
     {
         assert(bit::is_power_of_two(seg_size));
     }
@@ -124,10 +130,22 @@ public:
         m_size = 0;
     }
 
+    /// @brief Clear and return all segments to the allocator.
+    void release()
+    {
+        m_segments.clear();
+        m_segments.shrink_to_fit();
+        clear();
+        m_capacity = 0;
+    }
+
     size_t num_segments() const { return m_segments.size(); }
     size_t size() const { return m_size; }
     size_t capacity() const { return m_capacity; }
+    size_t memory_usage() const { return m_capacity + m_segments.capacity() * sizeof(SegmentType); }
 };
+
+using SegmentedBuffer = BasicSegmentedBuffer<SegmentAllocator<uint8_t>>;
 }
 
 #endif
@@ -339,6 +339,14 @@ public:
     bool empty() const noexcept { return m_size == 0; }
     const auto& segments() const noexcept { return m_segments; }
 
+    size_t memory_usage() const noexcept
+    {
+        size_t bytes = 0;
+        for (const auto& seg : m_segments)
+            bytes += seg.capacity() * sizeof(block_type);
+        return bytes;
+    }
+
 private:
     std::vector<std::vector<block_type>> m_segments;
 
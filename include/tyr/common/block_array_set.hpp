@@ -121,6 +121,14 @@ public:
     size_t length() const noexcept { return m_pool->length(); }
     const auto& segments() const noexcept { return m_pool->segments(); }
 
+    size_t memory_usage() const noexcept
+    {
+        size_t bytes = 0;
+        bytes += m_pool ? m_pool->memory_usage() : 0;
+        bytes += m_set.capacity() * (sizeof(index_type) + sizeof(gtl::priv::ctrl_t));
+        return bytes;
+    }
+
 private:
     struct Hash
     {
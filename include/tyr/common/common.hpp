@@ -37,9 +37,11 @@
 #include "tyr/common/memory.hpp"
 #include "tyr/common/observer_ptr.hpp"
 #include "tyr/common/onetbb.hpp"
+#include "tyr/common/perf_counters.hpp"
 #include "tyr/common/raw_array_pool.hpp"
 #include "tyr/common/raw_array_set.hpp"
 #include "tyr/common/segmented_vector.hpp"
+#include "tyr/common/trace.hpp"
 #include "tyr/common/types.hpp"
 #include "tyr/common/uint_mixins.hpp"
 #include "tyr/common/unordered_set.hpp"
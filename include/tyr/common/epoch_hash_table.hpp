@@ -0,0 +1,336 @@
+/*
+ * Copyright (C) 2025 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef TYR_COMMON_EPOCH_HASH_TABLE_HPP_
+#define TYR_COMMON_EPOCH_HASH_TABLE_HPP_
+
+#include "tyr/common/equal_to.hpp"
+#include "tyr/common/hash.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <gtl/phmap.hpp>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace tyr
+{
+
+/**
+ * Generation-stamped open-addressing hash tables.
+ *
+ * The tables are meant for per-evaluation scratch data that is cleared far more often than it grows.
+ * A slot is occupied iff its stamp equals the current epoch, so clear() bumps the epoch instead of touching the slots,
+ * and the capacity is retained across clears, which avoids the rehash and allocation churn of clearing a flat hash set.
+ * The entries are stored densely in insertion order; erase() moves the last entry into the gap.
+ */
+
+namespace detail
+{
+
+/// @brief `EpochSlots` is the linear probing index shared by `EpochHashSet` and `EpochHashMap`.
+/// Slots refer to positions in the dense entry array of the owning table.
+class EpochSlots
+{
+public:
+    EpochSlots() : m_slots(), m_mask(0), m_epoch(1) {}
+
+    /// @brief Return the slot whose entry is accepted by `matches`, or the free slot where such an entry must be placed.
+    template<typename Matches>
+    size_t probe(size_t h, Matches&& matches) const noexcept
+    {
+        assert(!m_slots.empty());
+
+        for (auto i = h & m_mask;; i = (i + 1) & m_mask)
+            if (!is_occupied(i) || matches(m_slots[i].pos))
+                return i;
+    }
+
+    bool is_occupied(size_t i) const noexcept { return m_slots[i].stamp == m_epoch; }
+    uint32_t get_pos(size_t i) const noexcept { return m_slots[i].pos; }
+    void set_pos(size_t i, uint32_t pos) noexcept { m_slots[i].pos = pos; }
+    void occupy(size_t i, uint32_t pos) noexcept { m_slots[i] = Slot { m_epoch, pos }; }
+
+    /// @brief Ensure room for one more entry at a load factor of at most 1/2, reinserting the `size` existing entries.
+    template<typename HashOf>
+    void reserve_for_insert(size_t size, HashOf&& hash_of)
+    {
+        if (2 * (size + 1) <= m_slots.size())
+            return;
+
+        auto capacity = std::max<size_t>(m_slots.size(), 16);
+        while (2 * (size + 1) > capacity)
+            capacity *= 2;
+
+        m_slots.assign(capacity, Slot {});
+        m_mask = capacity - 1;
+        m_epoch = 1;
+
+        for (uint32_t pos = 0; pos < size; ++pos)
+            occupy(probe(hash_of(pos), [](uint32_t) { return false; }), pos);
+    }
+
+    /// @brief Vacate slot `i` by shifting back the entries of its probe sequence.
+    template<typename HashOf>
+    void vacate(size_t i, HashOf&& hash_of) noexcept
+    {
+        for (auto j = (i + 1) & m_mask; is_occupied(j); j = (j + 1) & m_mask)
+        {
+            const auto home = hash_of(m_slots[j].pos) & m_mask;
+
+            // The entry in j may move into i iff its home does not lie cyclically in (i, j].
+            const auto stays = (i < j) ? (i < home && home <= j) : (i < home || home <= j);
+            if (!stays)
+            {
+                m_slots[i] = m_slots[j];
+                i = j;
+            }
+        }
+        m_slots[i].stamp = 0;
+    }
+
+    void clear() noexcept
+    {
+        // On wrap-around, reset the stamps so that stale slots cannot become occupied again.
+        if (++m_epoch == 0)
+        {
+            std::fill(m_slots.begin(), m_slots.end(), Slot {});
+            m_epoch = 1;
+        }
+    }
+
+    size_t capacity() const noexcept { return m_slots.size(); }
+
+    size_t memory_usage() const noexcept { return m_slots.capacity() * sizeof(Slot); }
+
+private:
+    struct Slot
+    {
+        uint32_t stamp = 0;
+        uint32_t pos = 0;
+    };
+
+    std::vector<Slot> m_slots;
+    size_t m_mask;
+    uint32_t m_epoch;
+};
+
+}
+
+template<typename K, typename H = Hash<K>, typename E = EqualTo<K>>
+class EpochHashSet
+{
+public:
+    using value_type = K;
+    using const_iterator = typename std::vector<K>::const_iterator;
+    using iterator = const_iterator;
+
+    EpochHashSet() = default;
+
+    std::pair<const_iterator, bool> insert(const K& key)
+    {
+        m_slots.reserve_for_insert(m_entries.size(), [this](uint32_t p) { return hash(m_entries[p]); });
+
+        const auto i = find_slot(key);
+        if (m_slots.is_occupied(i))
+            return { m_entries.begin() + m_slots.get_pos(i), false };
+
+        m_slots.occupy(i, static_cast<uint32_t>(m_entries.size()));
+        m_entries.push_back(key);
+        return { std::prev(m_entries.cend()), true };
+    }
+
+    const_iterator find(const K& key) const noexcept
+    {
+        if (m_entries.empty())
+            return m_entries.end();
+
+        const auto i = find_slot(key);
+        return m_slots.is_occupied(i) ? m_entries.begin() + m_slots.get_pos(i) : m_entries.end();
+    }
+
+    bool contains(const K& key) const noexcept { return find(key) != end(); }
+
+    size_t erase(const K& key) noexcept
+    {
+        if (m_entries.empty())
+            return 0;
+
+        const auto i = find_slot(key);
+        if (!m_slots.is_occupied(i))
+            return 0;
+
+        const auto pos = m_slots.get_pos(i);
+        m_slots.vacate(i, [this](uint32_t p) { return hash(m_entries[p]); });
+
+        const auto last = static_cast<uint32_t>(m_entries.size() - 1);
+        if (pos != last)
+        {
+            m_slots.set_pos(m_slots.probe(hash(m_entries[last]), [last](uint32_t p) { return p == last; }), pos);
+            m_entries[pos] = std::move(m_entries[last]);
+        }
+        m_entries.pop_back();
+        return 1;
+    }
+
+    /// @brief Remove all elements in O(1) for trivially destructible elements while retaining the capacity.
+    void clear() noexcept
+    {
+        m_entries.clear();
+        m_slots.clear();
+    }
+
+    bool empty() const noexcept { return m_entries.empty(); }
+    size_t size() const noexcept { return m_entries.size(); }
+    size_t capacity() const noexcept { return m_slots.capacity(); }
+
+    const_iterator begin() const noexcept { return m_entries.begin(); }
+    const_iterator end() const noexcept { return m_entries.end(); }
+
+    size_t memory_usage() const noexcept { return m_entries.capacity() * sizeof(K) + m_slots.memory_usage(); }
+
+private:
+    static size_t hash(const K& key) noexcept { return gtl::phmap_mix<sizeof(size_t)>()(H {}(key)); }
+
+    size_t find_slot(const K& key) const noexcept
+    {
+        return m_slots.probe(hash(key), [this, &key](uint32_t pos) { return E {}(m_entries[pos], key); });
+    }
+
+    std::vector<K> m_entries;
+    detail::EpochSlots m_slots;
+};
+
+template<typename K, typename V, typename H = Hash<K>, typename E = EqualTo<K>>
+class EpochHashMap
+{
+public:
+    using key_type = K;
+    using mapped_type = V;
+    using value_type = std::pair<K, V>;
+    using iterator = typename std::vector<value_type>::iterator;
+    using const_iterator = typename std::vector<value_type>::const_iterator;
+
+    EpochHashMap() = default;
+
+    template<typename M>
+    std::pair<iterator, bool> insert_or_assign(const K& key, M&& value)
+    {
+        m_slots.reserve_for_insert(m_entries.size(), [this](uint32_t p) { return hash(m_entries[p].first); });
+
+        const auto i = find_slot(key);
+        if (m_slots.is_occupied(i))
+        {
+            const auto it = m_entries.begin() + m_slots.get_pos(i);
+            it->second = std::forward<M>(value);
+            return { it, false };
+        }
+
+        m_slots.occupy(i, static_cast<uint32_t>(m_entries.size()));
+        m_entries.emplace_back(key, std::forward<M>(value));
+        return { std::prev(m_entries.end()), true };
+    }
+
+    iterator find(const K& key) noexcept
+    {
+        if (m_entries.empty())
+            return m_entries.end();
+
+        const auto i = find_slot(key);
+        return m_slots.is_occupied(i) ? m_entries.begin() + m_slots.get_pos(i) : m_entries.end();
+    }
+
+    const_iterator find(const K& key) const noexcept
+    {
+        if (m_entries.empty())
+            return m_entries.end();
+
+        const auto i = find_slot(key);
+        return m_slots.is_occupied(i) ? m_entries.begin() + m_slots.get_pos(i) : m_entries.end();
+    }
+
+    bool contains(const K& key) const noexcept { return find(key) != end(); }
+
+    size_t erase(const K& key) noexcept
+    {
+        if (m_entries.empty())
+            return 0;
+
+        const auto i = find_slot(key);
+        if (!m_slots.is_occupied(i))
+            return 0;
+
+        const auto pos = m_slots.get_pos(i);
+        m_slots.vacate(i, [this](uint32_t p) { return hash(m_entries[p].first); });
+
+        const auto last = static_cast<uint32_t>(m_entries.size() - 1);
+        if (pos != last)
+        {
+            m_slots.set_pos(m_slots.probe(hash(m_entries[last].first), [last](uint32_t p) { return p == last; }), pos);
+            m_entries[pos] = std::move(m_entries[last]);
+        }
+        m_entries.pop_back();
+        return 1;
+    }
+
+    /// @brief Remove all elements in O(1) for trivially destructible elements while retaining the capacity.
+    void clear() noexcept
+    {
+        m_entries.clear();
+        m_slots.clear();
+    }
+
+    bool empty() const noexcept { return m_entries.empty(); }
+    size_t size() const noexcept { return m_entries.size(); }
+    size_t capacity() const noexcept { return m_slots.capacity(); }
+
+    iterator begin() noexcept { return m_entries.begin(); }
+    iterator end() noexcept { return m_entries.end(); }
+    const_iterator begin() const noexcept { return m_entries.begin(); }
+    const_iterator end() const noexcept { return m_entries.end(); }
+
+    size_t memory_usage() const noexcept { return m_entries.capacity() * sizeof(value_type) + m_slots.memory_usage(); }
+
+private:
+    static size_t hash(const K& key) noexcept { return gtl::phmap_mix<sizeof(size_t)>()(H {}(key)); }
+
+    size_t find_slot(const K& key) const noexcept
+    {
+        return m_slots.probe(hash(key), [this, &key](uint32_t pos) { return E {}(m_entries[pos].first, key); });
+    }
+
+    std::vector<value_type> m_entries;
+    detail::EpochSlots m_slots;
+};
+
+template<typename K, typename H, typename E>
+size_t get_memory_usage(const EpochHashSet<K, H, E>& set) noexcept
+{
+    return set.memory_usage();
+}
+
+template<typename K, typename V, typename H, typename E>
+size_t get_memory_usage(const EpochHashMap<K, V, H, E>& map) noexcept
+{
+    return map.memory_usage();
+}
+
+}
+
+#endif
@@ -0,0 +1,124 @@
+/*
+ * Copyright (C) 2025 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef TYR_COMMON_MAPPED_FILE_HPP_
+#define TYR_COMMON_MAPPED_FILE_HPP_
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#if defined(__linux__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#include <fstream>
+#include <iterator>
+#include <vector>
+#endif
+
+namespace tyr
+{
+
+/// @brief A file that is memory-mapped read-only for the lifetime of the object.
+///
+/// On platforms without mmap, the file is read into a buffer instead.
+class MappedFile
+{
+public:
+#if defined(__linux__) || defined(__APPLE__)
+    explicit MappedFile(const std::filesystem::path& filepath) : m_data(nullptr), m_size(0)
+    {
+        const auto fd = ::open(filepath.c_str(), O_RDONLY);
+        if (fd == -1)
+            throw std::runtime_error("MappedFile::MappedFile(...): Failed to open " + filepath.string() + ": " + std::strerror(errno) + ".");
+
+        struct stat st;
+        if (::fstat(fd, &st) == -1)
+        {
+            ::close(fd);
+            throw std::runtime_error("MappedFile::MappedFile(...): Failed to stat " + filepath.string() + ": " + std::strerror(errno) + ".");
+        }
+
+        m_size = static_cast<size_t>(st.st_size);
+
+        if (m_size > 0)
+        {
+            auto* data = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (data == MAP_FAILED)
+            {
+                ::close(fd);
+                throw std::runtime_error("MappedFile::MappedFile(...): Failed to map " + filepath.string() + ": " + std::strerror(errno) + ".");
+            }
+            m_data = static_cast<const uint8_t*>(data);
+        }
+
+        // The mapping stays valid after closing the descriptor.
+        ::close(fd);
+    }
+
+    ~MappedFile()
+    {
+        if (m_data)
+            ::munmap(const_cast<uint8_t*>(m_data), m_size);
+    }
+#else
+    explicit MappedFile(const std::filesystem::path& filepath) : m_data(nullptr), m_size(0), m_buffer()
+    {
+        auto in = std::ifstream(filepath, std::ios::binary);
+        if (!in)
+            throw std::runtime_error("MappedFile::MappedFile(...): Failed to open " + filepath.string() + ".");
+
+        m_buffer.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+        if (in.bad())
+            throw std::runtime_error("MappedFile::MappedFile(...): Failed to read " + filepath.string() + ".");
+
+        m_size = m_buffer.size();
+        m_data = m_buffer.empty() ? nullptr : reinterpret_cast<const uint8_t*>(m_buffer.data());
+    }
+
+    ~MappedFile() = default;
+#endif
+
+    MappedFile(const MappedFile& other) = delete;
+    MappedFile& operator=(const MappedFile& other) = delete;
+    MappedFile(MappedFile&& other) = delete;
+    MappedFile& operator=(MappedFile&& other) = delete;
+
+    static std::shared_ptr<const MappedFile> create(const std::filesystem::path& filepath) { return std::make_shared<const MappedFile>(filepath); }
+
+    const uint8_t* data() const noexcept { return m_data; }
+    size_t size() const noexcept { return m_size; }
+
+private:
+    const uint8_t* m_data;
+    size_t m_size;
+#if !(defined(__linux__) || defined(__APPLE__))
+    std::vector<char> m_buffer;
+#endif
+};
+
+}
+
+#endif
@@ -68,6 +68,39 @@ inline int64_t get_peak_memory_usage_in_bytes()
     return memory_in_kb * 1024;
 }
 
+inline int64_t get_current_memory_usage_in_bytes()
+{
+    // On error, returns -1 without a warning since this is meant to be sampled periodically.
+    int64_t memory_in_kb = -1;
+
+#if defined(__APPLE__)
+    task_basic_info t_info;
+    mach_msg_type_number_t t_info_count = TASK_BASIC_INFO_COUNT;
+
+    if (task_info(mach_task_self(), TASK_BASIC_INFO, reinterpret_cast<task_info_t>(&t_info), &t_info_count) == KERN_SUCCESS)
+    {
+        memory_in_kb = t_info.resident_size / 1024;
+    }
+#else
+    std::ifstream procfile("/proc/self/status");
+    std::string word;
+    while (procfile >> word)
+    {
+        if (word == "VmRSS:")
+        {
+            procfile >> memory_in_kb;
+            break;
+        }
+        // Skip to end of line.
+        procfile.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+    }
+    if (procfile.fail())
+        memory_in_kb = -1;
+#endif
+
+    return (memory_in_kb == -1) ? -1 : memory_in_kb * 1024;
+}
+
 }
 
 #endif
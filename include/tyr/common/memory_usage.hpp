@@ -0,0 +1,67 @@
+/*
+ * Copyright (C) 2025 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef TYR_COMMON_MEMORY_USAGE_HPP_
+#define TYR_COMMON_MEMORY_USAGE_HPP_
+
+#include <boost/dynamic_bitset.hpp>
+#include <cstddef>
+#include <gtl/phmap.hpp>
+#include <vector>
+
+namespace tyr
+{
+
+/**
+ * Estimates of the heap memory owned by standard containers.
+ *
+ * The estimates are based on the capacity and ignore allocator overhead.
+ * They are meant for accounting which subsystem holds memory, not for exact measurements.
+ */
+
+template<typename Block, typename Allocator>
+size_t get_memory_usage(const boost::dynamic_bitset<Block, Allocator>& bitset) noexcept
+{
+    return bitset.num_blocks() * sizeof(Block);
+}
+
+template<typename... Ts>
+size_t get_memory_usage(const gtl::flat_hash_set<Ts...>& set) noexcept
+{
+    return set.capacity() * (sizeof(typename gtl::flat_hash_set<Ts...>::value_type) + sizeof(gtl::priv::ctrl_t));
+}
+
+template<typename... Ts>
+size_t get_memory_usage(const gtl::flat_hash_map<Ts...>& map) noexcept
+{
+    return map.capacity() * (sizeof(typename gtl::flat_hash_map<Ts...>::value_type) + sizeof(gtl::priv::ctrl_t));
+}
+
+/// @brief Nested containers, e.g., `std::vector<std::vector<T>>`, are accounted for recursively.
+template<typename T, typename Allocator>
+size_t get_memory_usage(const std::vector<T, Allocator>& vec) noexcept
+{
+    auto bytes = vec.capacity() * sizeof(T);
+    if constexpr (requires(const T& element) { get_memory_usage(element); })
+        for (const auto& element : vec)
+            bytes += get_memory_usage(element);
+    return bytes;
+}
+
+}
+
+#endif
@@ -0,0 +1,132 @@
+/*
+ * Copyright (C) 2025 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef TYR_COMMON_PERF_COUNTERS_HPP_
+#define TYR_COMMON_PERF_COUNTERS_HPP_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+
+namespace tyr
+{
+
+/// @brief Hardware event counts of the calling thread.
+/// All counts are zero if the counters are not compiled in (`TYR_ENABLE_PERF_COUNTERS`) or not available on the machine.
+struct PerfCounters
+{
+    uint64_t cycles { 0 };
+    uint64_t instructions { 0 };
+    uint64_t cache_misses { 0 };
+    uint64_t branch_misses { 0 };
+
+    PerfCounters& operator+=(const PerfCounters& other) noexcept
+    {
+        cycles += other.cycles;
+        instructions += other.instructions;
+        cache_misses += other.cache_misses;
+        branch_misses += other.branch_misses;
+        return *this;
+    }
+
+    friend PerfCounters operator-(const PerfCounters& lhs, const PerfCounters& rhs) noexcept
+    {
+        return PerfCounters { lhs.cycles - rhs.cycles,
+                              lhs.instructions - rhs.instructions,
+                              lhs.cache_misses - rhs.cache_misses,
+                              lhs.branch_misses - rhs.branch_misses };
+    }
+
+    bool empty() const noexcept { return cycles == 0 && instructions == 0 && cache_misses == 0 && branch_misses == 0; }
+
+    /// @brief Instructions per cycle.
+    double ipc() const noexcept { return cycles > 0 ? static_cast<double>(instructions) / static_cast<double>(cycles) : 0.0; }
+};
+
+inline std::ostream& operator<<(std::ostream& os, const PerfCounters& el)
+{
+    if (el.empty())
+        return os << "unavailable";
+
+    return os << "IPC = " << el.ipc() << ", cycles = " << el.cycles << ", instructions = " << el.instructions << ", cache misses = " << el.cache_misses
+              << ", branch misses = " << el.branch_misses;
+}
+
+/// @brief `PerfCounterGroup` holds the Linux perf event descriptors of the calling thread.
+/// Counters that cannot be opened, e.g., due to `perf_event_paranoid` or missing PMU support in virtual machines, read as zero.
+class PerfCounterGroup
+{
+public:
+    /// @brief Get the counters of the calling thread, opening them on first use.
+    static PerfCounterGroup& get_thread_instance();
+
+    PerfCounterGroup(const PerfCounterGroup& other) = delete;
+    PerfCounterGroup& operator=(const PerfCounterGroup& other) = delete;
+    PerfCounterGroup(PerfCounterGroup&& other) = delete;
+    PerfCounterGroup& operator=(PerfCounterGroup&& other) = delete;
+
+    ~PerfCounterGroup();
+
+    bool is_available() const noexcept { return m_available; }
+
+    PerfCounters read() const noexcept;
+
+private:
+    PerfCounterGroup();
+
+    std::array<int, 4> m_fds;
+    bool m_available;
+};
+
+#ifdef TYR_ENABLE_PERF_COUNTERS
+
+/// @brief `PerfCounterScope` adds the hardware events of the calling thread during its lifetime to `counters`.
+/// It is the counterpart of `StopwatchScope` and is placed next to it.
+struct PerfCounterScope
+{
+    PerfCounterScope(PerfCounters& counters) noexcept :
+        m_counters(counters),
+        m_group(PerfCounterGroup::get_thread_instance()),
+        m_start(m_group.is_available() ? m_group.read() : PerfCounters {})
+    {
+    }
+
+    ~PerfCounterScope()
+    {
+        if (m_group.is_available())
+            m_counters += m_group.read() - m_start;
+    }
+
+    PerfCounters& m_counters;
+    const PerfCounterGroup& m_group;
+    PerfCounters m_start;
+};
+
+#else
+
+/// @brief No-op since hardware counters are not compiled in.
+struct PerfCounterScope
+{
+    PerfCounterScope(PerfCounters&) noexcept {}
+};
+
+#endif
+
+}
+
+#endif
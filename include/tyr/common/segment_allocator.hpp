@@ -0,0 +1,137 @@
+/*
+ * Copyright (C) 2025 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef TYR_COMMON_SEGMENT_ALLOCATOR_HPP_
+#define TYR_COMMON_SEGMENT_ALLOCATOR_HPP_
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+namespace tyr
+{
+
+enum class HugePageMode
+{
+    TRANSPARENT,  ///< Request transparent huge pages with `MADV_HUGEPAGE`
+    EXPLICIT,     ///< Map from the preallocated 2 MB huge page pool with `MAP_HUGETLB`, falling back to transparent huge pages
+};
+
+/// @brief `HugePageAllocator` is an allocator for the segments of `SegmentedVector` and `SegmentedBuffer`.
+///
+/// Allocations of at least `HUGE_PAGE_SIZE` bytes are mapped with `mmap`, rounded up to whole huge pages, and advised to use huge pages.
+/// Transparent mappings are not reserved in swap, and elements are default-initialized, hence, pages are committed lazily on first write.
+/// Deallocation unmaps the range and returns the memory to the operating system.
+/// Smaller allocations and platforms without `mmap` use the global `operator new`.
+template<typename T, HugePageMode Mode = HugePageMode::TRANSPARENT>
+class HugePageAllocator
+{
+public:
+    using value_type = T;
+
+    template<typename U>
+    struct rebind
+    {
+        using other = HugePageAllocator<U, Mode>;
+    };
+
+    static constexpr size_t HUGE_PAGE_SIZE = size_t(2) << 20;
+
+    HugePageAllocator() noexcept = default;
+    template<typename U>
+    HugePageAllocator(const HugePageAllocator<U, Mode>&) noexcept
+    {
+    }
+
+    T* allocate(size_t n)
+    {
+        const auto bytes = n * sizeof(T);
+
+#if defined(__linux__)
+        if (bytes >= HUGE_PAGE_SIZE)
+        {
+            const auto length = round_up(bytes);
+            void* ptr = MAP_FAILED;
+
+            // Explicit huge pages are reserved, since faulting on an exhausted pool raises SIGBUS instead of failing here.
+            if constexpr (Mode == HugePageMode::EXPLICIT)
+                ptr = ::mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+
+            if (ptr == MAP_FAILED)
+            {
+                ptr = ::mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+                if (ptr == MAP_FAILED)
+                    throw std::bad_alloc();
+                ::madvise(ptr, length, MADV_HUGEPAGE);
+            }
+            return static_cast<T*>(ptr);
+        }
+#endif
+        return static_cast<T*>(::operator new(bytes, std::align_val_t(alignof(T))));
+    }
+
+    void deallocate(T* ptr, size_t n) noexcept
+    {
+        const auto bytes = n * sizeof(T);
+
+#if defined(__linux__)
+        if (bytes >= HUGE_PAGE_SIZE)
+        {
+            ::munmap(ptr, round_up(bytes));
+            return;
+        }
+#endif
+        ::operator delete(ptr, std::align_val_t(alignof(T)));
+    }
+
+    /// @brief Default-initialize instead of value-initialize, so that resizing a segment does not touch its pages.
+    template<typename U>
+    void construct(U* ptr) noexcept(std::is_nothrow_default_constructible_v<U>)
+    {
+        ::new (static_cast<void*>(ptr)) U;
+    }
+
+    template<typename U, typename... Args>
+    void construct(U* ptr, Args&&... args)
+    {
+        ::new (static_cast<void*>(ptr)) U(std::forward<Args>(args)...);
+    }
+
+    friend bool operator==(const HugePageAllocator&, const HugePageAllocator&) noexcept { return true; }
+
+private:
+    static size_t round_up(size_t bytes) noexcept { return (bytes + HUGE_PAGE_SIZE - 1) & ~(HUGE_PAGE_SIZE - 1); }
+};
+
+/// @brief The default allocator of segmented containers, selected with the `TYR_ENABLE_HUGE_PAGES` build option.
+#ifdef TYR_ENABLE_HUGE_PAGES
+template<typename T>
+using SegmentAllocator = HugePageAllocator<T>;
+#else
+template<typename T>
+using SegmentAllocator = std::allocator<T>;
+#endif
+
+}
+
+#endif
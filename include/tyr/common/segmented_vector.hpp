@@ -19,6 +19,7 @@
 #define TYR_COMMON_SEGMENTED_VECTOR_HPP_
 
 #include "tyr/common/bit.hpp"
+#include "tyr/common/segment_allocator.hpp"
 
 #include <bit>
 #include <cassert>
@@ -30,7 +31,7 @@
 
 namespace tyr
 {
-template<typename T, size_t FirstSegmentSize = 32>
+template<typename T, size_t FirstSegmentSize = 32, typename Allocator = SegmentAllocator<T>>
 class SegmentedVector
 {
     static_assert(bit::is_power_of_two(FirstSegmentSize));
@@ -74,6 +75,15 @@ public:
 
     void clear() noexcept { m_size = 0; }
 
+    /// @brief Clear and return all segments to the allocator.
+    void release() noexcept
+    {
+        m_segments.clear();
+        m_segments.shrink_to_fit();
+        m_capacity = 0;
+        m_size = 0;
+    }
+
     void push_back(const T& element)
     {
         resize_to_fit(m_size + 1);
@@ -167,7 +177,7 @@ public:
 
 private:
     // Segments grow geometrically, i.e., FirstSegmentSize, 2*FirstSegmentSize, 4*FirstSegmentSize, ...
-    std::vector<std::vector<T>> m_segments;
+    std::vector<std::vector<T, Allocator>> m_segments;
     size_t m_capacity;
     size_t m_size;
 };
@@ -0,0 +1,176 @@
+/*
+ * Copyright (C) 2025 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef TYR_COMMON_TRACE_HPP_
+#define TYR_COMMON_TRACE_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <vector>
+
+namespace tyr::trace
+{
+
+/// @brief A completed interval on the timeline of a thread.
+/// `name` and `category` must be string literals since only the pointers are recorded.
+struct Event
+{
+    const char* name;
+    const char* category;
+    int64_t arg;
+    uint64_t begin_ns;
+    uint64_t end_ns;
+};
+
+/// @brief `ThreadBuffer` is a fixed-capacity ring buffer of events that is written by a single thread.
+/// The storage grows with the recorded events up to the capacity. When full, the oldest events are overwritten.
+class ThreadBuffer
+{
+public:
+    ThreadBuffer(uint32_t thread_id, size_t capacity) : m_thread_id(thread_id), m_capacity(capacity), m_events(), m_next(0) {}
+
+    void push_back(const Event& event)
+    {
+        if (m_events.size() < m_capacity)
+            m_events.push_back(event);
+        else
+            m_events[m_next] = event;
+        m_next = (m_next + 1 == m_capacity) ? 0 : m_next + 1;
+    }
+
+    void clear() noexcept
+    {
+        m_events.clear();
+        m_next = 0;
+    }
+
+    /// @brief Call `callback` on the events from oldest to newest.
+    template<typename Callback>
+    void for_each(Callback&& callback) const
+    {
+        const auto first = (m_events.size() < m_capacity) ? size_t(0) : m_next;
+        for (size_t i = 0; i < m_events.size(); ++i)
+            callback(m_events[(first + i) % m_events.size()]);
+    }
+
+    uint32_t get_thread_id() const noexcept { return m_thread_id; }
+    size_t size() const noexcept { return m_events.size(); }
+    size_t capacity() const noexcept { return m_capacity; }
+
+private:
+    uint32_t m_thread_id;
+    size_t m_capacity;
+    std::vector<Event> m_events;
+    size_t m_next;
+};
+
+/// @brief `Tracer` collects events of all threads into per-thread ring buffers and exports them in the Chrome trace event format,
+/// which can be opened in chrome://tracing or https://ui.perfetto.dev.
+///
+/// Tracing is disabled by default, in which case a `TraceScope` costs a single relaxed atomic load.
+/// Recording is lock-free; only the first event of a thread takes a lock to register its buffer.
+/// Exporting and clearing must not run concurrently with traced work.
+class Tracer
+{
+public:
+    static Tracer& instance();
+
+    /// @brief Start recording events.
+    /// @param capacity is the maximum number of events that are kept per thread. It applies to threads that record their first event afterwards.
+    void enable(size_t capacity = size_t(1) << 16);
+
+    void disable() noexcept { m_enabled.store(false, std::memory_order_relaxed); }
+
+    bool is_enabled() const noexcept { return m_enabled.load(std::memory_order_relaxed); }
+
+    /// @brief Discard all recorded events.
+    void clear();
+
+    void record(const Event& event);
+
+    uint64_t now_ns() const noexcept
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_origin).count();
+    }
+
+    /// @brief Write all recorded events as Chrome trace JSON.
+    void write_chrome_trace(std::ostream& out) const;
+    void write_chrome_trace(const std::filesystem::path& filepath) const;
+
+    size_t get_num_events() const;
+
+private:
+    Tracer();
+
+    ThreadBuffer& get_thread_buffer();
+
+    std::atomic_bool m_enabled;
+    std::chrono::steady_clock::time_point m_origin;
+
+    mutable std::mutex m_mutex;
+    size_t m_capacity;
+    std::vector<std::unique_ptr<ThreadBuffer>> m_buffers;
+};
+
+/// @brief `TraceScope` records the lifetime of the scope as an event if tracing is enabled.
+class TraceScope
+{
+public:
+    /// @param name is the name of the event.
+    /// @param category is the category of the event.
+    /// @param arg is an optional index, e.g., of a rule, that is shown in the event details. Negative values are omitted.
+    explicit TraceScope(const char* name, const char* category, int64_t arg = -1) noexcept :
+        m_name(name),
+        m_category(category),
+        m_arg(arg),
+        m_active(Tracer::instance().is_enabled()),
+        m_begin_ns(m_active ? Tracer::instance().now_ns() : 0)
+    {
+    }
+
+    ~TraceScope()
+    {
+        if (m_active)
+        {
+            auto& tracer = Tracer::instance();
+            tracer.record(Event { m_name, m_category, m_arg, m_begin_ns, tracer.now_ns() });
+        }
+    }
+
+    TraceScope(const TraceScope& other) = delete;
+    TraceScope& operator=(const TraceScope& other) = delete;
+    TraceScope(TraceScope&& other) = delete;
+    TraceScope& operator=(TraceScope&& other) = delete;
+
+private:
+    const char* m_name;
+    const char* m_category;
+    int64_t m_arg;
+    bool m_active;
+    uint64_t m_begin_ns;
+};
+
+}
+
+#endif
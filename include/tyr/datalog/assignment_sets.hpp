@@ -21,6 +21,7 @@
 #include "tyr/analysis/domains.hpp"
 #include "tyr/common/closed_interval.hpp"
 #include "tyr/common/config.hpp"
+#include "tyr/common/memory_usage.hpp"
 #include "tyr/datalog/assignment.hpp"
 #include "tyr/datalog/fact_sets.hpp"
 #include "tyr/datalog/formatter.hpp"
@@ -63,6 +64,8 @@ struct PerfectAssignmentHash
     size_t get_rank(const EdgeAssignment& assignment) const noexcept;
 
     size_t size() const noexcept;
+
+    size_t memory_usage() const noexcept;
 };
 
 template<formalism::FactKind T>
@@ -80,6 +83,8 @@ public:
 
     void reset() noexcept;
 
+    size_t memory_usage() const noexcept;
+
     void insert(formalism::datalog::PredicateBindingView<T> binding);
 
     bool operator[](const VertexAssignment& assignment) const noexcept;
@@ -104,6 +109,8 @@ public:
 
     void reset() noexcept;
 
+    size_t memory_usage() const noexcept;
+
     void insert(formalism::datalog::GroundAtomView<T> ground_atom);
     void insert(formalism::datalog::PredicateBindingView<T> binding);
     void insert(formalism::datalog::PredicateBindingForwardRangeView<T> bindings);
@@ -129,6 +136,8 @@ public:
 
     void reset() noexcept;
 
+    size_t memory_usage() const noexcept;
+
     void insert(formalism::datalog::FunctionBindingView<T> binding, float_t value);
     void insert(formalism::datalog::GroundFunctionTermValueView<T> fterm_value);
 
@@ -156,6 +165,8 @@ public:
 
     void reset() noexcept;
 
+    size_t memory_usage() const noexcept;
+
     void insert(formalism::datalog::GroundFunctionTermView<T> function_term, float_t value);
     void insert(formalism::datalog::GroundFunctionTermListView<T> function_terms, const std::vector<float_t>& values);
     void insert(formalism::datalog::GroundFunctionTermValueListView<T> fterm_values);
@@ -189,6 +200,8 @@ struct TaggedAssignmentSets
     void insert(const TaggedFactSets<T>& fact_sets);
 
     void reset() noexcept;
+
+    size_t memory_usage() const noexcept;
 };
 
 struct AssignmentSets
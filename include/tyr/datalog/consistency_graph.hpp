@@ -279,6 +279,9 @@ public:
     const details::LiteralToRuleInfos& get_predicate_to_anchors() const noexcept;
     const kpkc::DeduplicatedAdjacencyMatrix& get_adjacency_matrix() const noexcept;
 
+    /// @brief Return the memory of the vertices, partitions, and adjacency matrix.
+    size_t memory_usage() const noexcept;
+
 private:
     formalism::datalog::RuleView m_rule;
     formalism::datalog::ConjunctiveConditionView m_condition;
@@ -27,8 +27,6 @@
 #include "tyr/datalog/workspaces/program.hpp"
 #include "tyr/datalog/workspaces/rule.hpp"
 
-#include <ranges>
-
 namespace tyr::datalog
 {
 
@@ -71,7 +69,7 @@ struct ProgramExecutionContext
         // Initialize assignment sets
         ws.facts.assignment_sets.insert(ws.facts.fact_sets);
 
-        // Initialize delta facts; seems unnecessary after moving into stratum exection context
+        // Initialize delta facts; unnecessary because the first iteration of each rule reads all facts
         // ws.facts.delta_fact_sets.insert(ws.facts.fact_sets);
 
         // Reset cost buckets.
@@ -82,11 +80,7 @@ struct ProgramExecutionContext
      * Subcontext
      */
 
-    auto get_stratum_execution_contexts()
-    {
-        return ws.schedulers.data
-               | std::views::transform([this](RuleSchedulerStratum& scheduler) { return StratumExecutionContext<OrAP, AndAP, TP> { scheduler, *this }; });
-    }
+    auto get_stratum_execution_context(uint_t stratum) { return StratumExecutionContext<OrAP, AndAP, TP> { ws.schedulers.get_stratum(stratum), *this }; }
 
     ProgramWorkspace<OrAP, AndAP, TP>& ws;
     const ConstProgramWorkspace& cws;
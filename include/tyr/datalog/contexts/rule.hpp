@@ -169,8 +169,11 @@ struct RuleExecutionContext
     {
         // std::cout << cws_rule.get_rule() << std::endl;
 
+        // All facts are new in the first iteration of the rule, which allows its stratum to start in any fixpoint iteration.
+        const auto& delta_fact_sets = (ws_rule.common.kpkc.get_iteration() == 0) ? ctx.ctx.ws.facts.fact_sets : ctx.ctx.ws.facts.delta_fact_sets;
+
         ws_rule.common.initialize_iteration(cws_rule.get_static_consistency_graph(),
-                                            ctx.ctx.ws.facts.delta_fact_sets,
+                                            delta_fact_sets,
                                             AssignmentSets { ctx.ctx.cws.facts.assignment_sets, ctx.ctx.ws.facts.assignment_sets });
     }
 
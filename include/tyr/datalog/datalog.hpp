@@ -26,6 +26,7 @@
 #include "tyr/datalog/delta_kpkc.hpp"
 #include "tyr/datalog/fact_sets.hpp"
 #include "tyr/datalog/formatter.hpp"
+#include "tyr/datalog/statistics/memory.hpp"
 #include "tyr/datalog/statistics/program.hpp"
 #include "tyr/datalog/statistics/rule.hpp"
 #include "tyr/datalog/workspaces/d2p.hpp"
@@ -61,6 +61,7 @@ struct ConstRuleWorkspace;
 
 class RuleSchedulerStratum;
 
+struct MemoryStatistics;
 struct ProgramStatistics;
 struct RuleStatistics;
 struct AggregatedRuleStatistics;
@@ -49,6 +49,11 @@ struct Workspace
     /// @brief Allocate workspace memory layout for a given graph layout.
     /// @param graph
     explicit Workspace(const GraphLayout& graph);
+
+    size_t memory_usage() const noexcept
+    {
+        return get_memory_usage(compatible_vertices_data) + get_memory_usage(partition_bits) + get_memory_usage(partial_solution);
+    }
 };
 
 class DeltaKPKC
@@ -111,6 +116,12 @@ public:
     size_t get_iteration() const noexcept { return m_iteration; }
     const auto& get_delta_edges() const noexcept { return m_delta_edges; }
 
+    size_t memory_usage() const noexcept
+    {
+        return m_layout.memory_usage() + m_delta_graph.memory_usage() + m_full_graph.memory_usage() + get_memory_usage(m_delta_edges)
+               + m_fact_induced_candidates.memory_usage();
+    }
+
 private:
     template<typename Callback>
     void for_each_new_unary_clique(Callback&& callback, Workspace& workspace) const;
@@ -18,18 +18,23 @@
 #ifndef TYR_DATALOG_DELTA_KPKC_GRAPH_HPP_
 #define TYR_DATALOG_DELTA_KPKC_GRAPH_HPP_
 
+#include "tyr/common/declarations.hpp"
 #include "tyr/common/dynamic_bitset.hpp"
 #include "tyr/common/equal_to.hpp"
 #include "tyr/common/formatter.hpp"
 #include "tyr/common/hash.hpp"
+#include "tyr/common/memory_usage.hpp"
 #include "tyr/common/vector.hpp"
 #include "tyr/datalog/declarations.hpp"
 #include "tyr/datalog/formatter.hpp"
 #include "tyr/formalism/datalog/variable_dependency_graph.hpp"
 
+#include <algorithm>
 #include <boost/dynamic_bitset.hpp>
 #include <cstddef>
+#include <functional>
 #include <iostream>
+#include <span>
 #include <vector>
 
 namespace tyr::datalog::kpkc
@@ -90,6 +95,11 @@ struct GraphLayout
 
     GraphLayout() = default;
     GraphLayout(size_t nv, const std::vector<std::vector<uint_t>>& vertex_partitions);
+
+    size_t memory_usage() const noexcept
+    {
+        return get_memory_usage(vertex_partitions) + get_memory_usage(vertex_to_partition) + get_memory_usage(vertex_to_bit) + get_memory_usage(info.infos);
+    }
 };
 
 class VertexPartitions
@@ -108,6 +118,8 @@ public:
     const auto& data() const noexcept { return m_data; }
     const auto& layout() const noexcept { return m_layout; }
 
+    size_t memory_usage() const noexcept { return get_memory_usage(m_data); }
+
 private:
     const GraphLayout& m_layout;
 
@@ -150,69 +162,130 @@ private:
     std::vector<uint64_t> m_bitset_data;
 };
 
+/// @brief `DeduplicatedAdjacencyMatrix` is an immutable adjacency matrix that shares equal rows and equal partition bitsets.
+///
+/// Each unique adjacency from a vertex into a partition is stored either as a dense bitset or as a sorted array of bits,
+/// whichever is smaller, such that sparse consistency graphs over many objects take memory proportional to their edges.
 class DeduplicatedAdjacencyMatrix
 {
 public:
-    DeduplicatedAdjacencyMatrix(const GraphLayout& layout) : m_layout(layout), m_row_offset(), m_row_data(), m_bitset_data() {}
+    struct Cell
+    {
+        static constexpr uint_t DENSE = uint_t(1) << (std::numeric_limits<uint_t>::digits - 1);
+
+        uint_t value;  ///< DENSE | offset into the bitset data if dense, otherwise the index of the sparse cell.
 
-    DeduplicatedAdjacencyMatrix(const AdjacencyMatrix& m) : m_layout(m.layout())
+        bool is_dense() const noexcept { return value & DENSE; }
+        uint_t get_index() const noexcept { return value & ~DENSE; }
+    };
+
+    /// @brief Writes the adjacencies of the vertices [first, last) into zeroed consecutive rows of `layout.info.num_blocks` blocks each.
+    using ComputeRows = std::function<void(uint_t first, uint_t last, std::span<uint64_t> rows)>;
+
+    DeduplicatedAdjacencyMatrix(const GraphLayout& layout) :
+        m_layout(layout),
+        m_row_offset(),
+        m_row_data(),
+        m_bitset_data(),
+        m_sparse_offsets(1, 0),
+        m_sparse_data()
     {
-        auto row_to_offset = UnorderedMap<std::span<const uint64_t>, uint_t> {};
-        auto partition_to_offset = UnorderedMap<BitsetSpan<const uint64_t>, uint_t> {};
+    }
 
-        for (uint_t v = 0; v < m.layout().nv; ++v)
-        {
-            const auto [it1, success1] = row_to_offset.emplace(m.get_row(v), m_row_data.size());
+    /// @brief Compute the rows in chunks and deduplicate each chunk as soon as it is computed, such that the dense matrix is never materialized.
+    /// The adjacencies of a chunk into each partition are deduplicated in parallel, then offsets are assigned and rows are deduplicated sequentially.
+    DeduplicatedAdjacencyMatrix(const GraphLayout& layout, const ComputeRows& compute_rows);
 
-            if (!success1)
-            {
-                m_row_offset.push_back(it1->second);
-                continue;  ///< succeeded row deduplication
-            }
-            m_row_offset.push_back(it1->second);  /// Build new row
+    explicit DeduplicatedAdjacencyMatrix(const AdjacencyMatrix& m);
 
-            for (uint_t k = 0; k < m.layout().k; ++k)
-            {
-                const auto b = m.get_bitset(v, k);
-                const auto [it2, success2] = partition_to_offset.emplace(b, m_bitset_data.size());
+    Cell get_cell(uint_t v, uint_t p) const noexcept
+    {
+        assert(v < m_row_offset.size());
+        assert(m_row_offset[v] + p < m_row_data.size());
 
-                if (!success2)
-                {
-                    m_row_data.push_back(it2->second);
-                    continue;  ///< succeeded partition deduplication
-                }
+        return Cell { m_row_data[m_row_offset[v] + p] };
+    }
+
+    bool test(uint_t v, uint_t p, uint_t bit) const noexcept
+    {
+        const auto cell = get_cell(v, p);
 
-                m_row_data.push_back(it2->second);  /// Build new bitset
+        if (cell.is_dense())
+            return get_dense_bitset(cell, p).test(bit);
 
-                /// New bitset encountered
-                m_bitset_data.insert(m_bitset_data.end(), b.blocks().begin(), b.blocks().end());
-            }
-        }
+        const auto bits = get_sparse_bits(cell);
+        return std::binary_search(bits.begin(), bits.end(), bit);
     }
 
-    auto get_bitset(uint_t v, uint_t p) const noexcept
+    /// @brief Call the callback on each bit in the adjacency from v into p.
+    template<typename Callback>
+    void for_each_bit(uint_t v, uint_t p, Callback&& callback) const
     {
-        const auto& info = m_layout.info.infos[p];
+        const auto cell = get_cell(v, p);
 
-        assert(v < m_row_offset.size());
-        assert(m_row_offset[v] + p < m_row_data.size());
-        const auto start = m_row_data[m_row_offset[v] + p];
+        if (cell.is_dense())
+            tyr::for_each_bit(callback, [](auto&& a) noexcept { return a; }, get_dense_bitset(cell, p));
+        else
+            for (const auto bit : get_sparse_bits(cell))
+                callback(size_t(bit));
+    }
 
-        return BitsetSpan<const uint64_t>(m_bitset_data.data() + start, info.num_bits);
+    /// @brief Call the callback on each bit in the adjacency from v into p that is set in `include` and unset in `exclude`.
+    template<typename Callback, std::unsigned_integral B1, std::unsigned_integral B2>
+    void for_each_bit(uint_t v, uint_t p, Callback&& callback, const BitsetSpan<B1>& include, const BitsetSpan<B2>& exclude) const
+    {
+        const auto cell = get_cell(v, p);
+
+        if (cell.is_dense())
+            tyr::for_each_bit(callback, [](auto&& a, auto&& b, auto&& c) noexcept { return a & b & ~c; }, get_dense_bitset(cell, p), include, exclude);
+        else
+            for (const auto bit : get_sparse_bits(cell))
+                if (include.test(bit) && !exclude.test(bit))
+                    callback(size_t(bit));
     }
 
     const auto& layout() const noexcept { return m_layout; }
     const auto& row_offset() const noexcept { return m_row_offset; }
     const auto& row_data() const noexcept { return m_row_data; }
     const auto& bitset_data() const noexcept { return m_bitset_data; }
+    const auto& sparse_offsets() const noexcept { return m_sparse_offsets; }
+    const auto& sparse_data() const noexcept { return m_sparse_data; }
+
+    size_t memory_usage() const noexcept
+    {
+        return m_layout.memory_usage() + get_memory_usage(m_row_offset) + get_memory_usage(m_row_data) + get_memory_usage(m_bitset_data)
+               + get_memory_usage(m_sparse_offsets) + get_memory_usage(m_sparse_data);
+    }
 
 private:
+    /// @brief Return the cell of an equal adjacency that was stored before, or store it as a new cell.
+    Cell get_or_create_cell(BitsetSpan<const uint64_t> b, UnorderedMap<size_t, Cell>& cells);
+
+    /// @brief Append the row of the next vertex, sharing the storage of an equal row that was appended before.
+    void append_row(std::span<const uint_t> row_cells, UnorderedMap<size_t, uint_t>& row_to_offset);
+
+    Cell create_cell(BitsetSpan<const uint64_t> b);
+
+    bool is_equal(Cell cell, BitsetSpan<const uint64_t> b) const noexcept;
+
+    BitsetSpan<const uint64_t> get_dense_bitset(Cell cell, uint_t p) const noexcept
+    {
+        return BitsetSpan<const uint64_t>(m_bitset_data.data() + cell.get_index(), m_layout.info.infos[p].num_bits);
+    }
+
+    std::span<const uint_t> get_sparse_bits(Cell cell) const noexcept
+    {
+        const auto index = cell.get_index();
+        return std::span<const uint_t>(m_sparse_data.data() + m_sparse_offsets[index], m_sparse_data.data() + m_sparse_offsets[index + 1]);
+    }
+
     GraphLayout m_layout;
 
-    std::vector<uint_t> m_row_offset;     ///< m_row_offset[v] is the offset into m_row_data
-    std::vector<uint_t> m_row_data;       ///< m_row_data[m_row_offset[v] + p] is the offset into m_bitset_data.
-    std::vector<uint64_t> m_bitset_data;  ///< m_bitset_data.data() + m_row_data[m_row_offset[v] + p] is beginning of the bitset data for the set of vertices
-                                          ///< from v into partition p.
+    std::vector<uint_t> m_row_offset;      ///< m_row_offset[v] is the offset into m_row_data
+    std::vector<uint_t> m_row_data;        ///< m_row_data[m_row_offset[v] + p] is the cell value of the set of vertices from v into partition p.
+    std::vector<uint64_t> m_bitset_data;   ///< Dense cells: m_bitset_data.data() + cell.get_index() is the beginning of the bitset data.
+    std::vector<uint_t> m_sparse_offsets;  ///< Sparse cells: m_sparse_data[m_sparse_offsets[i], m_sparse_offsets[i + 1]) are the sorted bits of cell i.
+    std::vector<uint_t> m_sparse_data;
 };
 
 class PartitionedAdjacencyMatrix
@@ -383,6 +456,8 @@ public:
     auto adj_span() const noexcept { return m_adj_span; }
     const auto& bitset_data() const noexcept { return m_bitset_data; }
 
+    size_t memory_usage() const noexcept { return get_memory_usage(m_adj_data) + get_memory_usage(m_touched_partitions) + get_memory_usage(m_bitset_data); }
+
 private:
     const GraphLayout& m_layout;
     const VertexPartitions& m_affected_partitions;
@@ -416,6 +491,8 @@ struct Graph
         matrix.reset();
     }
 
+    size_t memory_usage() const noexcept { return affected_partitions.memory_usage() + delta_partitions.memory_usage() + matrix.memory_usage(); }
+
     VertexPartitions affected_partitions;
     VertexPartitions delta_partitions;
     PartitionedAdjacencyMatrix matrix;
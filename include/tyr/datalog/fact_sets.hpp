@@ -20,6 +20,7 @@
 
 #include "tyr/common/equal_to.hpp"
 #include "tyr/common/hash.hpp"
+#include "tyr/common/memory_usage.hpp"
 #include "tyr/formalism/datalog/repository.hpp"
 
 #include <boost/dynamic_bitset.hpp>
@@ -47,6 +48,8 @@ public:
 
     void reset() noexcept;
 
+    size_t memory_usage() const noexcept;
+
     void insert(const PredicateFactSet<T>& other);
     void insert(formalism::datalog::GroundAtomView<T> ground_atom);
     void insert(formalism::datalog::PredicateBindingView<T> binding);
@@ -69,6 +72,8 @@ public:
 
     void reset() noexcept;
 
+    size_t memory_usage() const noexcept;
+
     void insert(const PredicateFactSets<T>& other);
     void insert(formalism::datalog::GroundAtomView<T> ground_atom);
     void insert(formalism::datalog::PredicateBindingView<T> binding);
@@ -96,6 +101,8 @@ public:
 
     void reset() noexcept;
 
+    size_t memory_usage() const noexcept;
+
     void insert(const FunctionFactSet& other);
     void insert(formalism::datalog::FunctionBindingView<T> binding, float_t value);
     void insert(formalism::datalog::FunctionBindingRandomAccessRangeView<T> bindings, const std::vector<float_t>& values);
@@ -122,6 +129,8 @@ public:
 
     void reset() noexcept;
 
+    size_t memory_usage() const noexcept;
+
     void insert(const FunctionFactSets& other);
     void insert(formalism::datalog::GroundFunctionTermView<T> function_term, float_t value);
     void insert(formalism::datalog::GroundFunctionTermListView<T> function_terms, const std::vector<float_t>& values);
@@ -152,6 +161,8 @@ struct TaggedFactSets
     void insert(const TaggedFactSets<T>& other);
 
     void reset() noexcept;
+
+    size_t memory_usage() const noexcept;
 };
 
 struct FactSets
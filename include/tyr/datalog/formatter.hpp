@@ -62,6 +62,8 @@ extern std::ostream& print(std::ostream& os, const datalog::kpkc::DeduplicatedAd
 
 extern std::ostream& print(std::ostream& os, const datalog::kpkc::PartitionedAdjacencyMatrix& el);
 
+extern std::ostream& print(std::ostream& os, const datalog::MemoryStatistics& el);
+
 extern std::ostream& print(std::ostream& os, const datalog::ProgramStatistics& el);
 
 extern std::ostream& print(std::ostream& os, const datalog::RuleStatistics& el);
@@ -117,6 +119,8 @@ extern std::ostream& operator<<(std::ostream& os, const PartitionedAdjacencyMatr
 
 }
 
+extern std::ostream& operator<<(std::ostream& os, const MemoryStatistics& el);
+
 extern std::ostream& operator<<(std::ostream& os, const ProgramStatistics& el);
 
 extern std::ostream& operator<<(std::ostream& os, const RuleStatistics& el);
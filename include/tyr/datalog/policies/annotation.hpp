@@ -29,6 +29,7 @@
 #include <cassert>
 #include <concepts>
 #include <limits>
+#include <memory>
 #include <optional>
 #include <tuple>
 #include <vector>
@@ -118,6 +119,13 @@ class AndAnnotationPolicy
 public:
     static constexpr AggregationFunction agg = AggregationFunction {};
 
+    AndAnnotationPolicy() = default;
+
+    /// @brief Override the cost of each rule by `rule_costs[rule.get_index()]`, e.g., with scaled action costs.
+    explicit AndAnnotationPolicy(std::shared_ptr<const std::vector<Cost>> rule_costs);
+
+    Cost get_rule_cost(formalism::datalog::RuleView rule) const noexcept;
+
     void update_annotation(formalism::datalog::PredicateBindingView<formalism::FluentTag> program_head,
                            formalism::datalog::PredicateBindingView<formalism::FluentTag> delta_head,
                            uint_t current_cost,
@@ -127,6 +135,9 @@ public:
                            AndAnnotationsMap& delta_and_annot,
                            formalism::datalog::GrounderContext& delta_context,
                            formalism::datalog::GrounderContext& iteration_context) const;
+
+private:
+    std::shared_ptr<const std::vector<Cost>> m_rule_costs;
 };
 
 }
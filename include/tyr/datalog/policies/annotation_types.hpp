@@ -19,6 +19,7 @@
 #define TYR_SOLVER_POLICIES_ANNOTATION_TYPES_HPP_
 
 #include "tyr/common/config.hpp"
+#include "tyr/common/epoch_hash_table.hpp"
 #include "tyr/common/vector.hpp"
 #include "tyr/datalog/policies/aggregation.hpp"
 #include "tyr/formalism/datalog/declarations.hpp"
@@ -57,7 +58,8 @@ private:
     Cost m_cost;
 };
 
-using AndAnnotationsMap = UnorderedMap<formalism::datalog::PredicateBindingView<formalism::FluentTag>, Witness>;
+/// @brief Cleared on every evaluation, hence a generation-stamped table that resets in O(1).
+using AndAnnotationsMap = EpochHashMap<formalism::datalog::PredicateBindingView<formalism::FluentTag>, Witness>;
 
 static_assert(sizeof(AndAnnotationsMap::value_type) == 40);
 
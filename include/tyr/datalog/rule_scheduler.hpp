@@ -20,6 +20,7 @@
 
 #include "tyr/analysis/listeners.hpp"              // for ListenerStratum
 #include "tyr/analysis/stratification.hpp"         // for RuleStratum, Rule...
+#include "tyr/common/config.hpp"                   // for uint_t
 #include "tyr/common/declarations.hpp"             // for UnorderedSet
 #include "tyr/common/equal_to.hpp"                 // for EqualTo
 #include "tyr/common/formatter.hpp"                // for operator<<
@@ -31,14 +32,26 @@
 #include "tyr/formalism/datalog/rule_index.hpp"    // for Index
 
 #include <boost/dynamic_bitset/dynamic_bitset.hpp>  // for dynamic_bitset
+#include <chrono>                                   // for nanoseconds
+#include <span>                                     // for span
 #include <vector>                                   // for vector
 
 namespace tyr::datalog
 {
 
+/// @brief `RuleSchedulerStratum` tracks the active rules of a stratum and orders them for execution.
+///
+/// The scheduler keeps an exponential moving average of the execution time of each rule.
+/// Active rules are ordered by decreasing estimate (longest processing time first), rules without estimate come first.
+/// Consecutive cheap rules are grouped into batches that amortize the task overhead.
 class RuleSchedulerStratum
 {
 public:
+    using RuleBatch = std::span<const Index<formalism::datalog::Rule>>;
+
+    /// @brief Rules are grouped into a batch until the estimated time of the batch reaches this value.
+    static constexpr auto BATCH_TIME = std::chrono::nanoseconds(20000);
+
     RuleSchedulerStratum(const analysis::RuleStratum& rules, const analysis::ListenerStratum& listeners, const formalism::datalog::Repository& context);
 
     void activate_all();
@@ -49,26 +62,87 @@ public:
 
     void on_finish_iteration();
 
+    /// @brief Update the time estimate of the rule from its accumulated execution time.
+    void update_time_estimate(Index<formalism::datalog::Rule> rule, std::chrono::nanoseconds total_time) noexcept;
+
     const formalism::datalog::Repository& get_context() const noexcept { return m_context; }
     const IndexList<formalism::datalog::Rule>& get_rules() const noexcept { return m_rules; }
-    const UnorderedSet<Index<formalism::datalog::Rule>>& get_active_rules() const noexcept { return m_active_rules; }
+    /// @brief Get the active rules, ordered by decreasing time estimate.
+    const IndexList<formalism::datalog::Rule>& get_active_rules() const noexcept { return m_active_rules; }
+    /// @brief Get the active rules, partitioned into consecutive batches.
+    const std::vector<RuleBatch>& get_active_rule_batches() const noexcept { return m_active_rule_batches; }
+    std::chrono::nanoseconds get_time_estimate(Index<formalism::datalog::Rule> rule) const noexcept;
 
 private:
+    void order_active_rules();
+
     const analysis::RuleStratum& m_rules;
     const analysis::ListenerStratum& m_listeners;
     const formalism::datalog::Repository& m_context;
 
     boost::dynamic_bitset<> m_active_predicates;
-    UnorderedSet<Index<formalism::datalog::Rule>> m_active_rules;
+    boost::dynamic_bitset<> m_active_rules_set;
+    IndexList<formalism::datalog::Rule> m_active_rules;
+    std::vector<RuleBatch> m_active_rule_batches;
+
+    std::vector<std::chrono::nanoseconds> m_time_estimates;  ///< Indexed by rule, negative if not executed yet
+    std::vector<std::chrono::nanoseconds> m_total_times;     ///< Indexed by rule, the accumulated time at the last update
 };
 
-struct RuleSchedulerStrata
+/// @brief `RuleSchedulerStrata` tracks the running strata and starts each stratum once the strata it depends on are finished.
+///
+/// In concurrent mode, the scheduled strata are the components of the condensation DAG of the predicate dependency graph.
+/// A component only waits for the components whose derived predicates occur in its rule bodies.
+/// Hence, independent components run together and share the fixpoint iterations.
+/// Otherwise, the scheduled strata are the minimal strata, which run one after another.
+class RuleSchedulerStrata
 {
-    std::vector<RuleSchedulerStratum> data;
-};
+public:
+    RuleSchedulerStrata(const analysis::RuleStrata& rules,
+                        const analysis::ListenerStrata& listeners,
+                        const formalism::datalog::Repository& context,
+                        bool concurrent);
+
+    /// @brief Start all strata without dependencies.
+    void start();
+
+    /// @brief Finish the running strata without active rules and start the strata that became ready.
+    void finish_idle();
+
+    /// @brief Finish all running strata and start the strata that became ready.
+    void finish_all();
+
+    void on_start_iteration() noexcept;
 
-extern RuleSchedulerStrata
-create_schedulers(const analysis::RuleStrata& rules, const analysis::ListenerStrata& listeners, const formalism::datalog::Repository& context);
+    /// @brief Notify the running strata about a generated head predicate, once per iteration.
+    void on_generate(Index<formalism::Predicate<formalism::FluentTag>> predicate);
+
+    void on_finish_iteration();
+
+    bool is_concurrent() const noexcept { return m_concurrent; }
+    RuleSchedulerStratum& get_stratum(uint_t stratum) noexcept { return m_strata[stratum]; }
+    const RuleSchedulerStratum& get_stratum(uint_t stratum) const noexcept { return m_strata[stratum]; }
+    const std::vector<RuleSchedulerStratum>& get_strata() const noexcept { return m_strata; }
+    /// @brief Get the running strata, i.e., started and not yet finished.
+    const std::vector<uint_t>& get_running_strata() const noexcept { return m_running; }
+
+private:
+    void start_stratum(uint_t stratum);
+
+    void finish_stratum(uint_t stratum);
+
+    std::vector<RuleSchedulerStratum> m_strata;
+    bool m_concurrent;
+
+    std::vector<std::vector<uint_t>> m_dependents;  ///< Indexed by stratum, the strata that wait for it
+    std::vector<uint_t> m_num_dependencies;         ///< Indexed by stratum, the number of strata it waits for
+    std::vector<uint_t> m_num_pending;              ///< Indexed by stratum, the number of unfinished strata it waits for
+
+    boost::dynamic_bitset<> m_generated_predicates;  ///< The head predicates generated in the current iteration
+
+    std::vector<uint_t> m_running;
+    std::vector<uint_t> m_finished;
+};
 
 }
 
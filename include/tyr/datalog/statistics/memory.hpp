@@ -0,0 +1,57 @@
+/*
+ * Copyright (C) 2025 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef TYR_DATALOG_STATISTICS_MEMORY_HPP_
+#define TYR_DATALOG_STATISTICS_MEMORY_HPP_
+
+#include <cstddef>
+
+namespace tyr::datalog
+{
+
+/// @brief Estimated memory in bytes held by the mutable workspaces of a program, broken down by component.
+struct MemoryStatistics
+{
+    size_t workspace_repository { 0 };  ///< Ground atoms and bindings derived during evaluation
+    size_t facts { 0 };                 ///< Fluent fact sets and assignment sets
+    size_t annotations { 0 };           ///< Program-level or- and and-annotations
+    size_t overlay_repositories { 0 };  ///< Per-worker overlay repositories of the rules
+    size_t rule_annotations { 0 };      ///< Per-worker and-annotations and head rows of the rules
+    size_t pending_rules { 0 };         ///< Per-worker pending rules and their applicability checks
+    size_t kpkc { 0 };                  ///< Dynamic consistency graphs and clique enumeration workspaces
+
+    size_t total() const noexcept
+    {
+        return workspace_repository + facts + annotations + overlay_repositories + rule_annotations + pending_rules + kpkc;
+    }
+
+    MemoryStatistics& operator+=(const MemoryStatistics& other) noexcept
+    {
+        workspace_repository += other.workspace_repository;
+        facts += other.facts;
+        annotations += other.annotations;
+        overlay_repositories += other.overlay_repositories;
+        rule_annotations += other.rule_annotations;
+        pending_rules += other.pending_rules;
+        kpkc += other.kpkc;
+        return *this;
+    }
+};
+
+}
+
+#endif
@@ -18,6 +18,8 @@
 #ifndef TYR_DATALOG_STATISTICS_PROGRAM_HPP_
 #define TYR_DATALOG_STATISTICS_PROGRAM_HPP_
 
+#include "tyr/common/perf_counters.hpp"
+
 #include <chrono>
 
 namespace tyr::datalog
@@ -27,6 +29,8 @@ struct ProgramStatistics
     uint_t num_executions { 0 };
     std::chrono::nanoseconds parallel_time { 0 };
     std::chrono::nanoseconds total_time { 0 };
+    PerfCounters merge_counters {};
+    PerfCounters total_counters {};  ///< Only events of the calling thread
 };
 }
 
@@ -18,6 +18,8 @@
 #ifndef TYR_DATALOG_STATISTICS_RULE_HPP_
 #define TYR_DATALOG_STATISTICS_RULE_HPP_
 
+#include "tyr/common/perf_counters.hpp"
+
 #include <algorithm>
 #include <chrono>
 #include <cstddef>
@@ -34,6 +36,7 @@ struct RuleStatistics
     std::chrono::nanoseconds process_generate_time { 0 };
     std::chrono::nanoseconds process_pending_time { 0 };
     std::chrono::nanoseconds total_time { 0 };
+    PerfCounters process_generate_counters {};
 };
 
 struct RuleWorkerStatistics
@@ -50,6 +53,7 @@ struct AggregatedRuleStatistics
     std::chrono::nanoseconds process_generate_time { 0 };
     std::chrono::nanoseconds process_pending_time { 0 };
     std::chrono::nanoseconds total_time { 0 };
+    PerfCounters process_generate_counters {};
 
     size_t sample_count { 0 };
     std::chrono::nanoseconds tot_time_min { 0 };
@@ -88,6 +92,7 @@ inline AggregatedRuleStatistics compute_aggregated_rule_statistics(const std::ve
         result.initialize_time += rs.initialize_time;
         result.process_generate_time += rs.process_generate_time;
         result.process_pending_time += rs.process_pending_time;
+        result.process_generate_counters += rs.process_generate_counters;
     }
 
     result.sample_count = samples.size();
@@ -46,6 +46,8 @@ struct FactsWorkspace
                             const formalism::datalog::Repository& workspace_repository);
 
     void reset();
+
+    size_t memory_usage() const noexcept;
 };
 
 struct ConstFactsWorkspace
@@ -61,6 +63,8 @@ struct ConstFactsWorkspace
                                  formalism::datalog::GroundAtomListView<formalism::StaticTag> atoms,
                                  formalism::datalog::GroundFunctionTermValueListView<formalism::StaticTag> fterm_values,
                                  const formalism::datalog::Repository& program_repository);
+
+    size_t memory_usage() const noexcept;
 };
 
 }
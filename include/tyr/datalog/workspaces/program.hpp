@@ -18,12 +18,14 @@
 #ifndef TYR_DATALOG_WORKSPACES_PROGRAM_HPP_
 #define TYR_DATALOG_WORKSPACES_PROGRAM_HPP_
 
+#include "tyr/common/epoch_hash_table.hpp"
 #include "tyr/common/equal_to.hpp"
 #include "tyr/common/hash.hpp"
 #include "tyr/datalog/policies/annotation.hpp"
 #include "tyr/datalog/policies/termination.hpp"
 #include "tyr/datalog/program_context.hpp"
 #include "tyr/datalog/rule_scheduler.hpp"
+#include "tyr/datalog/statistics/memory.hpp"
 #include "tyr/datalog/statistics/program.hpp"
 #include "tyr/datalog/workspaces/d2p.hpp"
 #include "tyr/datalog/workspaces/facts.hpp"
@@ -31,20 +33,32 @@
 #include "tyr/formalism/datalog/builder.hpp"
 #include "tyr/formalism/planning/builder.hpp"
 
+#include <algorithm>
+#include <bit>
 #include <chrono>
+#include <concepts>
+#include <limits>
 #include <oneapi/tbb/enumerable_thread_specific.h>
+#include <ranges>
 #include <vector>
 
 namespace tyr::datalog
 {
+/// @brief `CostBuckets` is a monotone radix heap over the costs of the `OrAnnotationPolicy`.
+///
+/// An element with cost c lives in bucket bit_width(c ^ current_cost()), hence the number of buckets is bounded by the bits of `Cost`
+/// instead of the largest cost, which admits large costs, e.g., real-valued action costs scaled to integers.
+/// Bucket 0 holds the elements whose cost equals the current cost. Each bucket maps an element to its least cost.
 class CostBuckets
 {
 public:
     using ViewType = formalism::datalog::PredicateBindingView<formalism::FluentTag>;
-    using Bucket = UnorderedSet<ViewType>;
     using Cost = uint_t;
+    using Bucket = EpochHashMap<ViewType, Cost>;
 
-    CostBuckets() : m_buckets(1), m_current(0), m_total_size(0) {}
+    static constexpr size_t NUM_BUCKETS = std::numeric_limits<Cost>::digits + 1;
+
+    CostBuckets() : m_buckets(NUM_BUCKETS), m_current(0), m_total_size(0) {}
 
     void clear() noexcept
     {
@@ -58,29 +72,27 @@ public:
 
     [[nodiscard]] bool empty() const noexcept { return m_total_size == 0; }
 
-    void resize_to_fit(Cost c)
-    {
-        if (c >= m_buckets.size())
-            m_buckets.resize(static_cast<size_t>(c) + 1);
-    }
-
     bool insert(Cost c, ViewType a)
     {
-        resize_to_fit(c);
-        const auto [it, inserted] = m_buckets[c].insert(a);
-        if (inserted)
-            ++m_total_size;
-        return inserted;
+        auto& bucket = m_buckets[get_bucket_index(c)];
+        if (const auto it = bucket.find(a); it != bucket.end())
+        {
+            it->second = std::min(it->second, c);
+            return false;
+        }
+        bucket.insert_or_assign(a, c);
+        ++m_total_size;
+        return true;
     }
 
     bool erase(Cost c, ViewType a)
     {
-        if (c >= m_buckets.size())
+        auto& bucket = m_buckets[get_bucket_index(c)];
+        if (const auto it = bucket.find(a); it == bucket.end() || it->second != c)
             return false;
-        const auto erased = m_buckets[c].erase(a) > 0;
-        if (erased)
-            --m_total_size;
-        return erased;
+        bucket.erase(a);
+        --m_total_size;
+        return true;
     }
 
     void update(const CostUpdate& update, ViewType a)
@@ -92,36 +104,50 @@ public:
 
     void clear_current()
     {
-        if (m_current >= m_buckets.size())
-            return;
-        m_total_size -= m_buckets[m_current].size();
-        m_buckets[m_current].clear();
+        m_total_size -= m_buckets[0].size();
+        m_buckets[0].clear();
     }
 
+    /// @brief Advance the current cost to the least cost of any element and move these elements into bucket 0.
     bool advance_to_next_nonempty()
     {
-        while (m_current < m_buckets.size() && m_buckets[m_current].empty())
-            ++m_current;
-        return m_current < m_buckets.size();
-    }
+        if (!m_buckets[0].empty())
+            return true;
 
-    const Bucket& get_current_bucket() const
-    {
-        static const Bucket kEmpty {};
-        if (m_current >= m_buckets.size())
-            return kEmpty;
-        return m_buckets[m_current];
+        auto i = size_t(1);
+        while (i < NUM_BUCKETS && m_buckets[i].empty())
+            ++i;
+        if (i == NUM_BUCKETS)
+            return false;
+
+        auto& source = m_buckets[i];
+        m_current = std::ranges::min(source | std::views::values);
+
+        // All elements of bucket i agree with the new current cost on the bits at and above i, hence move into lower buckets.
+        for (const auto& [a, c] : source)
+            m_buckets[get_bucket_index(c)].insert_or_assign(a, c);
+        source.clear();
+
+        return true;
     }
 
+    auto get_current_bucket() const { return m_buckets[0] | std::views::keys; }
+
 private:
+    size_t get_bucket_index(Cost c) const noexcept { return (c <= m_current) ? 0 : std::bit_width(c ^ m_current); }
+
     std::vector<Bucket> m_buckets;
-    uint_t m_current = 0;
-    size_t m_total_size = 0;
+    Cost m_current;
+    size_t m_total_size;
 };
 
 template<typename OrAP, typename AndAP, typename TP>
 struct ProgramWorkspace
 {
+    /// @brief Without cost annotations, all heads have cost zero and independent strata can share the fixpoint iterations.
+    /// With cost annotations, each stratum must enumerate its costs from zero, and hence, the strata run one after another.
+    static constexpr bool CONCURRENT_STRATA = std::same_as<OrAP, NoOrAnnotationPolicy>;
+
     const formalism::datalog::Repository& program_repository;
     formalism::datalog::Repository& workspace_repository;
 
@@ -148,7 +174,16 @@ struct ProgramWorkspace
 
     ProgramStatistics statistics;
 
-    explicit ProgramWorkspace(ProgramContext& context, const ConstProgramWorkspace& cws, OrAP or_ap, AndAP and_ap, TP tp);
+    /// @brief Create the workspace; `concurrent_strata` may only be true if `CONCURRENT_STRATA` is true.
+    explicit ProgramWorkspace(ProgramContext& context,
+                              const ConstProgramWorkspace& cws,
+                              OrAP or_ap,
+                              AndAP and_ap,
+                              TP tp,
+                              bool concurrent_strata = CONCURRENT_STRATA);
+
+    /// @brief Return the estimated memory of the mutable state, including the shared workspace repository.
+    MemoryStatistics get_memory_statistics() const noexcept;
 };
 
 struct ConstProgramWorkspace
@@ -158,6 +193,9 @@ struct ConstProgramWorkspace
     std::vector<ConstRuleWorkspace> rules;
 
     explicit ConstProgramWorkspace(ProgramContext& context);
+
+    /// @brief Return the memory of the static fact sets and the static consistency graphs.
+    size_t memory_usage() const noexcept;
 };
 
 }
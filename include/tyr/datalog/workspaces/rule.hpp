@@ -19,6 +19,7 @@
 #define TYR_DATALOG_WORKSPACES_RULE_HPP_
 
 #include "tyr/common/declarations.hpp"
+#include "tyr/common/epoch_hash_table.hpp"
 #include "tyr/common/equal_to.hpp"
 #include "tyr/common/hash.hpp"
 #include "tyr/common/unique_object_pool.hpp"
@@ -26,6 +27,7 @@
 #include "tyr/datalog/consistency_graph.hpp"
 #include "tyr/datalog/delta_kpkc.hpp"
 #include "tyr/datalog/policies/annotation.hpp"
+#include "tyr/datalog/statistics/memory.hpp"
 #include "tyr/datalog/statistics/rule.hpp"
 #include "tyr/formalism/binding_index.hpp"
 #include "tyr/formalism/datalog/builder.hpp"
@@ -35,9 +37,11 @@
 #include "tyr/formalism/object_index.hpp"
 
 #include <atomic>
+#include <cassert>
 #include <chrono>
 #include <oneapi/tbb/enumerable_thread_specific.h>
 #include <oneapi/tbb/spin_mutex.h>
+#include <optional>
 #include <vector>
 
 namespace tyr::datalog
@@ -196,7 +200,7 @@ struct RuleWorkspace
 
         /// Heads
         Index<formalism::Predicate<formalism::FluentTag>> head_predicate;
-        UnorderedSet<Index<formalism::Row>> head_rows;
+        EpochHashSet<Index<formalism::Row>> head_rows;
 
         // Annotations stored in program_overlay_repository
         AndAnnotationsMap and_annot;
@@ -260,6 +264,9 @@ struct RuleWorkspace
 
     void clear() noexcept;
 
+    /// @brief Accumulate the memory of the kpkc graphs and of all workers.
+    MemoryStatistics get_memory_statistics() const noexcept;
+
     Common common;
 
     oneapi::tbb::enumerable_thread_specific<Worker> worker;
@@ -275,14 +282,22 @@ public:
     auto get_binary_overapproximation_rule() const noexcept { return binary_overapproximation_rule; }
     auto get_static_binary_overapproximation_rule() const noexcept { return static_binary_overapproximation_rule; }
     auto get_conflicting_overapproximation_rule() const noexcept { return conflicting_overapproximation_rule; }
-    const auto& get_static_consistency_graph() const noexcept { return static_consistency_graph; }
+    const auto& get_static_consistency_graph() const noexcept
+    {
+        assert(static_consistency_graph);
+        return *static_consistency_graph;
+    }
+
+    size_t memory_usage() const noexcept { return static_consistency_graph ? static_consistency_graph->memory_usage() : 0; }
 
-    ConstRuleWorkspace(formalism::datalog::RuleView rule,
-                       formalism::datalog::Repository& repository,
-                       const analysis::DomainListList& parameter_domains,
-                       size_t num_objects,
-                       size_t num_fluent_predicates,
-                       const TaggedAssignmentSets<formalism::StaticTag>& static_assignment_sets);
+    /// @brief Create the auxiliary rules in the repository. Requires exclusive access to the repository.
+    ConstRuleWorkspace(formalism::datalog::RuleView rule, formalism::datalog::Repository& repository);
+
+    /// @brief Compute the static consistency graph. Only reads the repository, hence, can run concurrently for different rules.
+    void compute_static_consistency_graph(const analysis::DomainListList& parameter_domains,
+                                          size_t num_objects,
+                                          size_t num_fluent_predicates,
+                                          const TaggedAssignmentSets<formalism::StaticTag>& static_assignment_sets);
 
 private:
     formalism::datalog::RuleView rule;
@@ -293,7 +308,7 @@ private:
     formalism::datalog::RuleView static_binary_overapproximation_rule;
     formalism::datalog::RuleView conflicting_overapproximation_rule;
 
-    StaticConsistencyGraph static_consistency_graph;
+    std::optional<StaticConsistencyGraph> static_consistency_graph;
 };
 
 /**
@@ -406,6 +421,26 @@ void RuleWorkspace<AndAP>::clear() noexcept
         w.clear();
 }
 
+template<typename AndAP>
+MemoryStatistics RuleWorkspace<AndAP>::get_memory_statistics() const noexcept
+{
+    auto result = MemoryStatistics {};
+
+    result.kpkc += common.kpkc.memory_usage();
+
+    for (const auto& w : worker)
+    {
+        result.overlay_repositories += w.iteration.workspace_overlay_repository.memory_usage();
+        result.overlay_repositories += w.solve.program_overlay_repository.memory_usage();
+        result.rule_annotations += get_memory_usage(w.iteration.head_rows) + get_memory_usage(w.iteration.and_annot);
+        result.pending_rules += get_memory_usage(w.solve.pending_rules);
+        result.pending_rules += w.solve.applicability_check_pool.get_size() * sizeof(ApplicabilityCheck);
+        result.kpkc += w.iteration.kpkc_workspace.memory_usage();
+    }
+
+    return result;
+}
+
 }
 
 #endif
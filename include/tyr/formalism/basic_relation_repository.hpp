@@ -234,6 +234,17 @@ public:
         return uint_t(row) >= slot->parent_size;
     }
 
+    /// @brief Return the memory owned by this layer, excluding the parent layers.
+    size_t memory_usage() const noexcept
+    {
+        size_t bytes = 0;
+        bytes += m_forward.capacity() * sizeof(uint_t);
+        bytes += m_slots.capacity() * sizeof(Slot);
+        for (const auto& slot : m_slots)
+            bytes += slot.container.memory_usage();
+        return bytes;
+    }
+
     bool exists_parent_mutation(Index<T> g) const noexcept
     {
         if (!m_parent)
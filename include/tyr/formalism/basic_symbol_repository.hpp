@@ -132,6 +132,27 @@ public:
 
     std::pair<Index<T>, bool> get_or_create_local(Data<T>& builder) { return get_or_create_local_with_hash(builder, BasicSymbolRepository::hash(builder)); }
 
+    /// @brief Insert an element that carries its final index and lives in memory that outlives the repository.
+    /// Elements with non-trivial storage are referenced in place, trivial ones are copied.
+    std::pair<Index<T>, bool> insert_external_local(const Data<T>& element)
+    {
+        auto& container = m_slot.container;
+        const auto h = BasicSymbolRepository::hash(element);
+
+        assert(uint_t(element.index) == m_slot.parent_size + container.size() && "The given element does not carry the next free index.");
+
+        if constexpr (uses_trivial_storage_v<T>)
+        {
+            const auto [index, success] = container.insert_with_hash(h, element);
+            return { Index<T>(m_slot.parent_size + uint_t(index)), success };
+        }
+        else
+        {
+            const auto [index, success] = container.insert_external_with_hash(h, element);
+            return { Index<T>(m_slot.parent_size + uint_t(index)), success };
+        }
+    }
+
     const Data<T>& at_local(Index<T> index) const noexcept
     {
         const auto parent_size = m_slot.parent_size;
@@ -148,6 +169,9 @@ public:
 
     size_t parent_size() const noexcept { return m_slot.parent_size; }
 
+    /// @brief Return the memory owned by this layer, excluding the parent layers.
+    size_t memory_usage() const noexcept { return m_arena->memory_usage() + m_slot.container.memory_usage(); }
+
     bool is_local(Index<T> index) const noexcept
     {
         assert(index != Index<T>::max() && "Unassigned index.");
@@ -75,6 +75,12 @@ public:
         std::apply([](auto&... repos) { (repos.clear(), ...); }, m_repositories);
     }
 
+    /// @brief Return the memory owned by this layer, excluding the parent layers.
+    size_t memory_usage() const noexcept
+    {
+        return std::apply([](const auto&... repos) { return (size_t { 0 } + ... + repos.memory_usage()); }, m_repositories);
+    }
+
     template<typename T>
     static size_t hash(const Data<RelationBinding<T>>& builder) noexcept
     {
@@ -148,6 +148,9 @@ public:
         m_relation_repository.clear();
     }
 
+    /// @brief Return the memory owned by this layer, excluding the parent layers.
+    size_t memory_usage() const noexcept { return m_symbol_repository.memory_usage() + m_relation_repository.memory_usage(); }
+
     /**
      * SymbolRepository forwarding.
      */
@@ -166,6 +169,18 @@ public:
         return get_or_create_with_hash(builder, SymbolRepo::hash(builder));
     }
 
+    /// @brief Insert an element that lives in immutable memory owned by the caller, e.g., a memory-mapped snapshot.
+    /// The element must carry the next free index. Elements with non-trivial storage are referenced in place.
+    template<typename T>
+        requires NonRelationBindingConcept<T>
+    std::pair<View<Index<T>, Repository>, bool> insert_external(const Data<T>& element)
+    {
+        assert(!m_symbol_repository.template exists_parent_mutation<T>() && "Integrity error: Parent SymbolRepository modified after child branching!");
+
+        const auto [index, success] = m_symbol_repository.insert_external_local(element);
+        return { View<Index<T>, Repository>(index, *this), success };
+    }
+
     template<typename T>
         requires NonRelationBindingConcept<T>
     const Data<T>& operator[](Index<T> index) const noexcept
@@ -72,6 +72,12 @@ public:
         std::apply([](auto&... repos) { (repos.clear(), ...); }, m_repositories);
     }
 
+    /// @brief Return the memory owned by this layer, excluding the parent layers.
+    size_t memory_usage() const noexcept
+    {
+        return std::apply([](const auto&... repos) { return (size_t { 0 } + ... + repos.memory_usage()); }, m_repositories);
+    }
+
     template<typename T>
     static size_t hash(const Data<T>& builder) noexcept
     {
@@ -106,6 +112,12 @@ public:
         return get<T>().get_or_create_local(builder);
     }
 
+    template<typename T>
+    auto insert_external_local(const Data<T>& element)
+    {
+        return get<T>().insert_external_local(element);
+    }
+
     template<typename T>
     const Data<T>& at_local(Index<T> index) const noexcept
     {
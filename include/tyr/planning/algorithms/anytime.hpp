@@ -0,0 +1,61 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef TYR_PLANNING_ALGORITHMS_ANYTIME_HPP_
+#define TYR_PLANNING_ALGORITHMS_ANYTIME_HPP_
+
+#include "tyr/planning/algorithms/utils.hpp"
+#include "tyr/planning/declarations.hpp"
+
+#include <limits>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace tyr::planning::anytime
+{
+
+template<typename Task>
+struct Options
+{
+    std::optional<Node<Task>> start_node = std::nullopt;
+    EventHandlerPtr<Task> event_handler = nullptr;
+    /// @brief The pruning strategy must preserve optimality.
+    PruningStrategyPtr<Task> pruning_strategy = nullptr;
+    GoalStrategyPtr<Task> goal_strategy = nullptr;
+    /// @brief The weights of the successive iterations. An infinite weight orders the open list by h_value only, i.e., GBFS.
+    std::vector<float_t> weights = { std::numeric_limits<float_t>::infinity(), 5, 3, 2, 1.5, 1 };
+    uint_t max_num_states = std::numeric_limits<uint_t>::max();
+    std::optional<std::chrono::steady_clock::duration> max_time = std::nullopt;
+    uint64_t random_seed = 0;
+    bool shuffle_labeled_succ_nodes = false;
+
+    Options() = default;
+};
+
+/// @brief Run restarting weighted A* with the given sequence of weights.
+///
+/// The search nodes, including the g_values, parents, and h_values, persist across iterations such that only the open list is rebuilt on a restart.
+/// Nodes whose g_value is not below the cost of the best plan found so far are pruned, and closed nodes are reopened when reached on a cheaper path.
+/// Hence, an iteration that exhausts its open list proves that the best plan found so far is optimal, and the search stops early.
+/// The result holds the cheapest plan found before the weights or the time limit are exhausted.
+template<typename Task>
+SearchResult<Task>
+find_solution(Task& task, SuccessorGenerator<Task>& successor_generator, Heuristic<Task>& heuristic, const Options<Task>& options = Options<Task>());
+}
+
+#endif
@@ -19,6 +19,7 @@
 #define TYR_PLANNING_ALGORITHMS_ASTAR_EAGER_EVENT_HANDLER_HPP_
 
 #include "tyr/formalism/planning/ground_action_view.hpp"
+#include "tyr/planning/algorithms/progress.hpp"
 #include "tyr/planning/algorithms/statistics.hpp"
 #include "tyr/planning/declarations.hpp"
 
@@ -261,6 +262,60 @@ public:
     static DefaultEventHandlerPtr<Task> create(size_t verbosity = 0);
 };
 
+/// @brief `JsonLinesEventHandler` writes machine-readable progress records as JSON lines.
+///
+/// It writes a record on start, on each finished f-layer, periodically during the search, and on termination.
+/// All events are forwarded to an optional inner handler, e.g., a `DefaultEventHandler` for human-readable output.
+template<typename Task>
+class JsonLinesEventHandler : public EventHandler<Task>
+{
+public:
+    JsonLinesEventHandler(ProgressWriter writer, EventHandlerPtr<Task> inner = nullptr);
+
+    static JsonLinesEventHandlerPtr<Task> create(int fd, std::chrono::milliseconds interval, ProgressProbe probe = {}, EventHandlerPtr<Task> inner = nullptr);
+
+    void on_expand_node(const Node<Task>& node) override;
+
+    void on_expand_goal_node(const Node<Task>& node) override;
+
+    void on_generate_node(const LabeledNode<Task>& labeled_succ_node) override;
+
+    void on_generate_node_relaxed(const LabeledNode<Task>& labeled_succ_node) override;
+
+    void on_generate_node_not_relaxed(const LabeledNode<Task>& labeled_succ_node) override;
+
+    void on_close_node(const Node<Task>& node) override;
+
+    void on_prune_node(const Node<Task>& node) override;
+
+    void on_start_search(const Node<Task>& node, float_t f_value) override;
+
+    void on_finish_f_layer(float_t f_value) override;
+
+    void on_end_search() override;
+
+    void on_solved(const Plan<Task>& plan) override;
+
+    void on_unsolvable() override;
+
+    void on_exhausted() override;
+
+    /**
+     * Getters
+     */
+
+    const tyr::planning::Statistics& get_statistics() const { return m_statistics; }
+
+private:
+    void write(std::string_view event);
+
+    ProgressWriter m_writer;
+    EventHandlerPtr<Task> m_inner;
+
+    tyr::planning::Statistics m_statistics;
+    float_t m_f_value;
+};
+
 }
 
 #endif
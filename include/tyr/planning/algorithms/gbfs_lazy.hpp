@@ -37,6 +37,11 @@ struct Options
     GoalStrategyPtr<Task> goal_strategy = nullptr;
     uint_t max_num_states = std::numeric_limits<uint_t>::max();
     std::optional<std::chrono::steady_clock::duration> max_time = std::nullopt;
+    /// @brief Upper bound on the bytes held by the task, the successor generator including the state repository, the heuristic,
+    /// the search nodes, the open lists, and the pruning strategy.
+    std::optional<size_t> max_memory_bytes = std::nullopt;
+    /// @brief The number of search iterations between two memory limit checks.
+    uint_t memory_check_interval = 1000;
     uint_t boost_preferred_queue = 1000;
     uint64_t random_seed = 0;
     bool shuffle_labeled_succ_nodes = false;
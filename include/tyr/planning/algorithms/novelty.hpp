@@ -0,0 +1,85 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef TYR_PLANNING_ALGORITHMS_NOVELTY_HPP_
+#define TYR_PLANNING_ALGORITHMS_NOVELTY_HPP_
+
+#include "tyr/common/config.hpp"
+#include "tyr/planning/declarations.hpp"
+#include "tyr/planning/state_view.hpp"
+
+#include <boost/dynamic_bitset.hpp>
+#include <cstddef>
+#include <vector>
+
+namespace tyr::planning
+{
+
+/// @brief `FactIndexMapper` assigns dense indices to the fluent facts and derived atoms of states.
+///
+/// Indices are assigned in the order in which the facts are first encountered such that novelty tables only grow as large as the reachable facts.
+template<typename Task>
+class FactIndexMapper
+{
+public:
+    FactIndexMapper();
+
+    /// @brief Write the dense indices of the fluent facts and derived atoms that hold in `state` into `out_fact_indices`.
+    void compute_fact_indices(const StateView<Task>& state, std::vector<uint_t>& out_fact_indices);
+
+    size_t size() const noexcept { return m_num_facts; }
+
+private:
+    uint_t get_or_create_index(uint_t& slot);
+
+    std::vector<std::vector<uint_t>> m_fluent_fact_indices;  ///< Indexed by FDR variable and value.
+    std::vector<uint_t> m_derived_atom_indices;              ///< Indexed by ground derived atom.
+    uint_t m_num_facts;
+};
+
+/// @brief `NoveltyTable` stores the tuples of facts of size at most `arity` seen so far.
+///
+/// Singletons are stored in a bitset over fact indices and pairs in a bitset over the perfect triangular index of `a < b`, i.e., `b * (b - 1) / 2 + a`.
+/// The triangular layout keeps existing indices stable when new facts are encountered.
+class NoveltyTable
+{
+public:
+    explicit NoveltyTable(size_t arity);
+
+    /// @brief Return the novelty of the given facts, i.e., the size of the smallest tuple that was not seen before, or `arity + 1` if there is none.
+    /// All tuples of size at most `arity` are marked as seen afterwards.
+    size_t test_and_insert(const std::vector<uint_t>& fact_indices);
+
+    void clear();
+
+    size_t get_arity() const noexcept { return m_arity; }
+
+    size_t memory_usage() const noexcept
+    {
+        return (m_singletons.num_blocks() + m_pairs.num_blocks()) * sizeof(boost::dynamic_bitset<>::block_type);
+    }
+
+private:
+    size_t m_arity;
+
+    boost::dynamic_bitset<> m_singletons;
+    boost::dynamic_bitset<> m_pairs;
+};
+
+}
+
+#endif
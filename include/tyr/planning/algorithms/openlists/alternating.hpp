@@ -128,6 +128,11 @@ public:
         return std::apply([](auto&&... queues) { return (queues.get().size() + ...); }, m_queues);
     }
 
+    std::size_t memory_usage() const noexcept
+    {
+        return std::apply([](auto&&... queues) { return (queues.get().memory_usage() + ...); }, m_queues);
+    }
+
     auto& get_weights() noexcept { return m_weights; }
     const auto& get_weights() const noexcept { return m_weights; }
 
@@ -34,6 +34,7 @@ concept IsOpenList = requires(T a, typename T::EntryType entry, typename T::Item
     { a.clear() } -> std::same_as<void>;
     { a.empty() } -> std::same_as<bool>;
     { a.size() } -> std::same_as<std::size_t>;
+    { a.memory_usage() } -> std::same_as<std::size_t>;
 };
 
 template<typename First, typename... Rest>
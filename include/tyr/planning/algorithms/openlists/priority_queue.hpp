@@ -78,6 +78,9 @@ public:
 
     std::size_t size() const { return m_priority_queue.size(); }
 
+    /// @brief Lower bound on the bytes held by the entries, the spare capacity of the underlying vector is not visible.
+    std::size_t memory_usage() const noexcept { return m_priority_queue.size() * sizeof(E); }
+
 private:
     std::priority_queue<E, std::vector<E>, EntryComparator> m_priority_queue;
 };
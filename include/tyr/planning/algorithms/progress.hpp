@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) 2025 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef TYR_PLANNING_ALGORITHMS_PROGRESS_HPP_
+#define TYR_PLANNING_ALGORITHMS_PROGRESS_HPP_
+
+#include "tyr/common/config.hpp"
+#include "tyr/planning/algorithms/statistics.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+
+namespace tyr::planning
+{
+
+/// @brief Counters of the search components that are sampled for each progress record.
+struct ProgressSample
+{
+    uint64_t num_states { 0 };
+    size_t states_memory_usage { 0 };
+    std::chrono::nanoseconds successor_generator_time { 0 };  ///< Total datalog time of the successor generator
+    std::chrono::nanoseconds axiom_evaluator_time { 0 };      ///< Total datalog time of the axiom evaluator
+    std::chrono::nanoseconds heuristic_time { 0 };            ///< Total datalog time of the heuristic
+};
+
+/// @brief Callback that samples the search components. The default-constructed probe reports zeros.
+using ProgressProbe = std::function<ProgressSample()>;
+
+/// @brief `ProgressWriter` writes search progress as JSON lines to a file descriptor.
+///
+/// Each line is a self-contained JSON object, so the output remains parseable when the process is killed.
+/// Periodic records are written at most once per interval. Checking whether a record is due costs a counter increment,
+/// and a clock read every `CHECK_PERIOD` calls.
+class ProgressWriter
+{
+public:
+    /// @param fd is the file descriptor to write to. It is not closed by the writer.
+    /// @param interval is the minimum time between two periodic records.
+    /// @param probe samples the search components for each record.
+    ProgressWriter(int fd, std::chrono::milliseconds interval, ProgressProbe probe = {});
+
+    /// @brief Reset the clock at the start of a search.
+    void start();
+
+    /// @brief Return true if the interval has elapsed since the last record.
+    bool is_due() noexcept
+    {
+        if ((++m_num_checks % CHECK_PERIOD) != 0)
+            return false;
+        return std::chrono::steady_clock::now() >= m_next_time_point;
+    }
+
+    /// @brief Write a single record.
+    /// @param event is the name of the event, e.g., "progress" or "solved".
+    /// @param statistics are the search statistics.
+    /// @param value_name is the name of the search specific value, e.g., "best_h" or "f".
+    /// @param value is the search specific value. Non-finite values are written as null.
+    void write(std::string_view event, const Statistics& statistics, std::string_view value_name, float_t value);
+
+private:
+    static constexpr uint64_t CHECK_PERIOD = 256;
+
+    int m_fd;
+    std::chrono::milliseconds m_interval;
+    ProgressProbe m_probe;
+
+    std::chrono::steady_clock::time_point m_start_time_point;
+    std::chrono::steady_clock::time_point m_last_time_point;
+    std::chrono::steady_clock::time_point m_next_time_point;
+    uint64_t m_last_num_expanded;
+    uint64_t m_num_checks;
+
+    std::string m_buffer;
+};
+
+}
+
+#endif
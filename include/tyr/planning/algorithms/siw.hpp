@@ -0,0 +1,55 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef TYR_PLANNING_ALGORITHMS_SIW_HPP_
+#define TYR_PLANNING_ALGORITHMS_SIW_HPP_
+
+#include "tyr/planning/algorithms/utils.hpp"
+#include "tyr/planning/declarations.hpp"
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace tyr::planning::siw
+{
+
+template<typename Task>
+struct Options
+{
+    std::optional<Node<Task>> start_node = std::nullopt;
+    /// @brief The event handler of the IW searches that solve the subproblems.
+    iw::EventHandlerPtr<Task> event_handler = nullptr;
+    PruningStrategyPtr<Task> pruning_strategy = nullptr;
+    /// @brief Each subproblem is attempted with IW(1), ..., IW(max_width). Must be 1 or 2.
+    uint_t max_width = 2;
+    uint_t max_num_states = std::numeric_limits<uint_t>::max();
+    std::optional<std::chrono::steady_clock::duration> max_time = std::nullopt;
+    uint64_t random_seed = 0;
+    bool shuffle_labeled_succ_nodes = false;
+
+    Options() = default;
+};
+
+/// @brief Run serialized IW, i.e., a sequence of IW searches where each one ends in a state with fewer unsatisfied goals than its start state.
+///
+/// The returned plan is the concatenation of the subplans.
+template<typename Task>
+SearchResult<Task> find_solution(Task& task, SuccessorGenerator<Task>& successor_generator, const Options<Task>& options = Options<Task>());
+}
+
+#endif
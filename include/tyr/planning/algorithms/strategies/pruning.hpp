@@ -37,6 +37,12 @@ public:
     virtual bool should_prune_state(const StateView<Task>& state) { return false; }
 
     virtual bool should_prune_successor_state(const StateView<Task>& state, const StateView<Task>& succ_state, bool is_new_succ) { return false; }
+
+    /// @brief Return true iff pruning never discards all optimal plans, which optimal searches such as A* require.
+    virtual bool preserves_optimality() const { return true; }
+
+    /// @brief Return the estimated number of bytes held by the strategy, which counts towards the memory limit of a search.
+    virtual size_t memory_usage() const { return 0; }
 };
 
 }
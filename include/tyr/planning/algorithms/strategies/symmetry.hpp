@@ -0,0 +1,93 @@
+/*
+ * Copyright (C) 2025 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef TYR_PLANNING_ALGORITHMS_STRATEGIES_SYMMETRY_HPP_
+#define TYR_PLANNING_ALGORITHMS_STRATEGIES_SYMMETRY_HPP_
+
+#include "tyr/common/declarations.hpp"
+#include "tyr/common/hash.hpp"
+#include "tyr/common/memory_usage.hpp"
+#include "tyr/planning/algorithms/strategies/pruning.hpp"
+#include "tyr/planning/declarations.hpp"
+#include "tyr/planning/state_repository.hpp"
+#include "tyr/planning/state_view.hpp"
+#include "tyr/planning/symmetries.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace tyr::planning
+{
+
+/// @brief `SymmetryPruningStrategy` prunes successor states that are symmetric to a previously generated state.
+///
+/// The search still expands concrete states, so plans are extracted as usual.
+/// The strategy is satisficing-only: a symmetric state is pruned even if it was reached on a cheaper path than the state generated first.
+template<typename Task>
+class SymmetryPruningStrategy : public PruningStrategy<Task>
+{
+public:
+    explicit SymmetryPruningStrategy(const Task& task) : m_symmetries(task), m_workspace(), m_key(), m_representative_key(), m_representatives() {}
+
+    static std::shared_ptr<SymmetryPruningStrategy<Task>> create(const Task& task) { return std::make_shared<SymmetryPruningStrategy<Task>>(task); }
+
+    bool should_prune_state(const StateView<Task>& state) override
+    {
+        if (!m_symmetries.empty())
+            is_symmetric_to_representative(state);
+        return false;
+    }
+
+    bool should_prune_successor_state(const StateView<Task>& state, const StateView<Task>& succ_state, bool is_new_succ) override
+    {
+        if (m_symmetries.empty() || !is_new_succ)
+            return false;
+        return is_symmetric_to_representative(succ_state);
+    }
+
+    bool preserves_optimality() const override { return false; }
+
+    size_t memory_usage() const override { return get_memory_usage(m_representatives); }
+
+    const ObjectSymmetries& get_symmetries() const noexcept { return m_symmetries; }
+
+private:
+    /// @brief Return true iff the state is symmetric to the representative of its key's hash, and register it as the representative if there is none.
+    ///
+    /// Distinct keys with the same hash are told apart by recomputing the key of the representative, in which case the state is not pruned.
+    bool is_symmetric_to_representative(const StateView<Task>& state)
+    {
+        m_symmetries.compute_state_key(state, m_workspace, m_key);
+
+        const auto [it, inserted] = m_representatives.emplace(Hash<std::vector<uint_t>> {}(m_key), state.get_index());
+        if (inserted || it->second == state.get_index())
+            return false;
+
+        m_symmetries.compute_state_key(state.get_state_repository()->get_registered_state(it->second), m_workspace, m_representative_key);
+        return m_key == m_representative_key;
+    }
+
+    ObjectSymmetries m_symmetries;
+    ObjectSymmetriesWorkspace m_workspace;
+    std::vector<uint_t> m_key;
+    std::vector<uint_t> m_representative_key;
+    UnorderedMap<size_t, Index<State<Task>>> m_representatives;  ///< Maps the hash of a state key to the first state with that key.
+};
+
+}
+
+#endif
@@ -44,6 +44,8 @@ struct SearchResult
     SearchStatus status = SearchStatus::IN_PROGRESS;
     std::optional<Plan<Task>> plan = std::nullopt;
     std::optional<Node<Task>> goal_node = std::nullopt;
+    size_t search_nodes_memory_usage = 0;  ///< Estimated memory of the search nodes upon termination
+    size_t openlist_memory_usage = 0;      ///< Estimated memory of the open list upon termination
 };
 
 }
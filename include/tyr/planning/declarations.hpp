@@ -37,6 +37,8 @@ template<typename Task>
 class UnpackedState;
 template<typename Task>
 class State;
+template<typename Task, typename Tag>
+class PackedState;
 
 template<typename Task>
 struct StateContext;
@@ -68,6 +70,18 @@ class Plan;
 
 class Statistics;
 
+namespace anytime
+{
+template<typename Task>
+class EventHandler;
+template<typename Task>
+using EventHandlerPtr = std::shared_ptr<EventHandler<Task>>;
+template<typename Task>
+class DefaultEventHandler;
+template<typename Task>
+using DefaultEventHandlerPtr = std::shared_ptr<DefaultEventHandler<Task>>;
+}
+
 namespace astar_eager
 {
 template<typename Task>
@@ -78,6 +92,10 @@ template<typename Task>
 class DefaultEventHandler;
 template<typename Task>
 using DefaultEventHandlerPtr = std::shared_ptr<DefaultEventHandler<Task>>;
+template<typename Task>
+class JsonLinesEventHandler;
+template<typename Task>
+using JsonLinesEventHandlerPtr = std::shared_ptr<JsonLinesEventHandler<Task>>;
 }
 
 namespace gbfs_lazy
@@ -90,6 +108,34 @@ template<typename Task>
 class DefaultEventHandler;
 template<typename Task>
 using DefaultEventHandlerPtr = std::shared_ptr<DefaultEventHandler<Task>>;
+template<typename Task>
+class JsonLinesEventHandler;
+template<typename Task>
+using JsonLinesEventHandlerPtr = std::shared_ptr<JsonLinesEventHandler<Task>>;
+}
+
+namespace iw
+{
+template<typename Task>
+class EventHandler;
+template<typename Task>
+using EventHandlerPtr = std::shared_ptr<EventHandler<Task>>;
+template<typename Task>
+class DefaultEventHandler;
+template<typename Task>
+using DefaultEventHandlerPtr = std::shared_ptr<DefaultEventHandler<Task>>;
+}
+
+namespace bfws
+{
+template<typename Task>
+class EventHandler;
+template<typename Task>
+using EventHandlerPtr = std::shared_ptr<EventHandler<Task>>;
+template<typename Task>
+class DefaultEventHandler;
+template<typename Task>
+using DefaultEventHandlerPtr = std::shared_ptr<DefaultEventHandler<Task>>;
 }
 }
 
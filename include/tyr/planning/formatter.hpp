@@ -40,16 +40,15 @@ extern std::ostream& print(std::ostream& os, const planning::LiftedTask& el);
 
 extern std::ostream& print(std::ostream& os, const planning::GroundTask& el);
 
-extern std::ostream& print(std::ostream& os, const Data<planning::State<planning::LiftedTask>>& el);
-
 extern std::ostream& print(std::ostream& os, const planning::UnpackedState<planning::LiftedTask>& el);
 
-extern std::ostream& print(std::ostream& os, const Data<planning::State<planning::GroundTask>>& el);
-
 extern std::ostream& print(std::ostream& os, const planning::UnpackedState<planning::GroundTask>& el);
 
 extern std::ostream& print(std::ostream& os, const planning::Statistics& el);
 
+template<typename Task, typename Tag>
+std::ostream& print(std::ostream& os, const Data<planning::PackedState<Task, Tag>>& el);
+
 template<typename Task>
 std::ostream& print(std::ostream& os, const planning::StateView<Task>& el);
 
@@ -66,16 +65,15 @@ extern std::ostream& operator<<(std::ostream& os, const LiftedTask& el);
 
 extern std::ostream& operator<<(std::ostream& os, const GroundTask& el);
 
-extern std::ostream& operator<<(std::ostream& os, const Data<State<LiftedTask>>& el);
-
 extern std::ostream& operator<<(std::ostream& os, const UnpackedState<LiftedTask>& el);
 
-extern std::ostream& operator<<(std::ostream& os, const Data<State<GroundTask>>& el);
-
 extern std::ostream& operator<<(std::ostream& os, const UnpackedState<GroundTask>& el);
 
 extern std::ostream& operator<<(std::ostream& os, const Statistics& el);
 
+template<typename Task, typename Tag>
+std::ostream& operator<<(std::ostream& os, const Data<PackedState<Task, Tag>>& el);
+
 template<typename Task>
 std::ostream& operator<<(std::ostream& os, const StateView<Task>& el);
 
@@ -29,6 +29,7 @@
 #include "tyr/planning/ground_task/match_tree/match_tree.hpp"  // for Matc...
 
 #include <boost/dynamic_bitset.hpp>  // for dynamic_bitset
+#include <filesystem>                // for path
 #include <limits>                    // for numeric_limits
 #include <stddef.h>                  // for size_t
 #include <vector>                    // for vector
@@ -41,11 +42,28 @@ class GroundTask
 public:
     explicit GroundTask(formalism::planning::PlanningFDRTask task);
 
+    /**
+     * Snapshots
+     */
+
+    /// @brief Write the formalism repository and the FDR task to a single versioned binary file.
+    /// @param filepath is the path of the snapshot file.
+    void save(const std::filesystem::path& filepath) const;
+
+    /// @brief Load a task from a snapshot written by `save`.
+    /// The file is memory-mapped read-only and its elements are referenced in place without deserialization.
+    /// @param filepath is the path of the snapshot file.
+    /// @return the ground task.
+    static GroundTaskPtr load_mmap(const std::filesystem::path& filepath);
+
     template<formalism::FactKind T>
     size_t get_num_atoms() const noexcept;
     size_t get_num_actions() const noexcept;
     size_t get_num_axioms() const noexcept;
 
+    /// @brief Return the memory of the task repository and of the match trees.
+    size_t memory_usage() const noexcept;
+
     const auto& get_static_atoms_bitset() const noexcept { return m_static_atoms_bitset; }
     const auto& get_static_numeric_variables() const noexcept { return m_static_numeric_variables; }
     bool test(Index<formalism::planning::GroundAtom<formalism::StaticTag>> index) const { return tyr::test(uint_t(index), m_static_atoms_bitset); }
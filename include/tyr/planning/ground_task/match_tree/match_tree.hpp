@@ -652,6 +652,11 @@ public:
     MatchTree(MatchTree&& other) = delete;
     MatchTree& operator=(MatchTree&& other) = delete;
 
+    size_t memory_usage() const noexcept
+    {
+        return m_elements.capacity() * sizeof(Index<Tag>) + m_context->memory_usage() + m_evaluate_stack.capacity() * sizeof(Data<Node<Tag>>);
+    }
+
     void generate(const StateContext<GroundTask>& state, IndexList<Tag>& out_applicable_elements)
     {
         out_applicable_elements.clear();
@@ -154,6 +154,12 @@ public:
     {
         std::apply([](auto&... slots) { (slots.container.clear(), ...); }, m_repository);
     }
+
+    /// @brief Get the estimated memory of the nodes.
+    size_t memory_usage() const noexcept
+    {
+        return m_arena.memory_usage() + std::apply([](const auto&... slots) { return (size_t { 0 } + ... + slots.container.memory_usage()); }, m_repository);
+    }
 };
 
 static_assert(RepositoryConcept<Repository<formalism::planning::GroundAction>>);
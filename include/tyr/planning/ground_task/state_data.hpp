@@ -26,7 +26,6 @@
 #include "tyr/planning/ground_task/state_storage/hash_set/fact.hpp"
 #include "tyr/planning/ground_task/state_storage/tree_compression/atom.hpp"
 #include "tyr/planning/ground_task/state_storage/tree_compression/fact.hpp"
-#include "tyr/planning/state_storage/config.hpp"
 #include "tyr/planning/state_storage/hash_set/numeric.hpp"
 #include "tyr/planning/state_storage/tree_compression/numeric.hpp"
 
@@ -39,26 +38,22 @@
 namespace tyr
 {
 
-template<>
-struct Data<planning::State<planning::GroundTask>>
+template<typename Tag>
+struct Data<planning::PackedState<planning::GroundTask, Tag>>
 {
 public:
     using TaskType = planning::GroundTask;
 
     Data() noexcept = default;
-    Data(Index<planning::State<TaskType>> index,
-         planning::FactPackedStorage<TaskType, planning::StateStoragePolicyTag> fact_storage,
-         planning::AtomPackedStorage<TaskType, planning::StateStoragePolicyTag> atom_storage,
-         planning::NumericPackedStorage<TaskType, planning::StateStoragePolicyTag> numeric_storage) noexcept :
-        m_index(index),
+    Data(planning::FactPackedStorage<TaskType, Tag> fact_storage,
+         planning::AtomPackedStorage<TaskType, Tag> atom_storage,
+         planning::NumericPackedStorage<TaskType, Tag> numeric_storage) noexcept :
         m_fact_storage(fact_storage),
         m_atom_storage(atom_storage),
         m_numeric_storage(numeric_storage)
     {
     }
 
-    Index<planning::State<TaskType>> get_index() const noexcept { return m_index; }
-
     template<formalism::FactKind T>
     const auto get_atoms() const noexcept
     {
@@ -75,11 +70,9 @@ public:
     auto identifying_members() const noexcept { return std::tie(m_fact_storage, m_atom_storage, m_numeric_storage); }
 
 private:
-    Index<planning::State<TaskType>> m_index;
-
-    planning::FactPackedStorage<TaskType, planning::StateStoragePolicyTag> m_fact_storage;
-    planning::AtomPackedStorage<TaskType, planning::StateStoragePolicyTag> m_atom_storage;
-    planning::NumericPackedStorage<TaskType, planning::StateStoragePolicyTag> m_numeric_storage;
+    planning::FactPackedStorage<TaskType, Tag> m_fact_storage;
+    planning::AtomPackedStorage<TaskType, Tag> m_atom_storage;
+    planning::NumericPackedStorage<TaskType, Tag> m_numeric_storage;
 };
 }
 
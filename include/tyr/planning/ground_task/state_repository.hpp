@@ -20,6 +20,7 @@
 
 #include "tyr/common/config.hpp"
 #include "tyr/common/indexed_hash_set.hpp"
+#include "tyr/common/perf_counters.hpp"
 #include "tyr/common/raw_array_set.hpp"
 #include "tyr/common/shared_object_pool.hpp"
 #include "tyr/planning/declarations.hpp"
@@ -35,6 +36,7 @@
 #include "tyr/planning/ground_task/state_storage/tree_compression/fact.hpp"
 #include "tyr/planning/state_storage/config.hpp"
 #include "tyr/planning/state_storage/hash_set/numeric.hpp"
+#include "tyr/planning/state_storage/storage.hpp"
 #include "tyr/planning/state_storage/tree_compression/numeric.hpp"
 
 #include <memory>
@@ -48,9 +50,13 @@ template<>
 class StateRepository<GroundTask> : public std::enable_shared_from_this<StateRepository<GroundTask>>
 {
 public:
-    explicit StateRepository(std::shared_ptr<GroundTask> task, ExecutionContextPtr execution_context);
+    explicit StateRepository(std::shared_ptr<GroundTask> task,
+                             ExecutionContextPtr execution_context,
+                             StateStoragePolicy storage_policy = StateStoragePolicy::TREE_COMPRESSION);
 
-    static std::shared_ptr<StateRepository<GroundTask>> create(std::shared_ptr<GroundTask> task, ExecutionContextPtr execution_context);
+    static std::shared_ptr<StateRepository<GroundTask>> create(std::shared_ptr<GroundTask> task,
+                                                               ExecutionContextPtr execution_context,
+                                                               StateStoragePolicy storage_policy = StateStoragePolicy::TREE_COMPRESSION);
 
     StateView<GroundTask> get_initial_state();
 
@@ -67,22 +73,24 @@ public:
 
     StateView<GroundTask> register_state(SharedObjectPoolPtr<UnpackedState<GroundTask>> state);
 
+    size_t get_num_states() const noexcept;
+
     size_t memory_usage() const noexcept;
 
     const auto& get_task() const noexcept { return m_task; }
+    StateStoragePolicy get_storage_policy() const noexcept { return m_storage_policy; }
     const auto& get_axiom_evaluator() const noexcept { return m_axiom_evaluator; }
+    const auto& get_register_state_perf_counters() const noexcept { return m_register_state_perf_counters; }
 
 private:
     std::shared_ptr<GroundTask> m_task;
 
-    StateStorageContext<GroundTask, StateStoragePolicyTag> m_context;
-    FactStorageBackend<GroundTask, StateStoragePolicyTag> m_fluent_backend;
-    AtomStorageBackend<GroundTask, StateStoragePolicyTag> m_derived_backend;
-    NumericStorageBackend<GroundTask, StateStoragePolicyTag> m_numeric_backend;
-
-    IndexedHashSet<State<GroundTask>> m_packed_states;
+    StateStoragePolicy m_storage_policy;
+    StateStorageVariant<GroundTask> m_storage;
     SharedObjectPool<UnpackedState<GroundTask>> m_unpacked_state_pool;
 
+    PerfCounters m_register_state_perf_counters;
+
     std::shared_ptr<AxiomEvaluator<GroundTask>> m_axiom_evaluator;
 };
 
@@ -21,10 +21,12 @@
 #include "tyr/planning/ground_task/node.hpp"        // for Node
 #include "tyr/planning/ground_task/state_view.hpp"  // for State
 //
+#include "tyr/common/perf_counters.hpp"
 #include "tyr/formalism/planning/ground_action_index.hpp"  // for Index
 #include "tyr/formalism/planning/ground_action_view.hpp"
 #include "tyr/planning/action_executor.hpp"
 #include "tyr/planning/declarations.hpp"
+#include "tyr/planning/state_storage/config.hpp"
 #include "tyr/planning/successor_generator.hpp"
 
 namespace tyr::planning
@@ -34,24 +36,37 @@ template<>
 class SuccessorGenerator<GroundTask>
 {
 public:
-    explicit SuccessorGenerator(std::shared_ptr<GroundTask> task, ExecutionContextPtr execution_context);
+    explicit SuccessorGenerator(std::shared_ptr<GroundTask> task,
+                                ExecutionContextPtr execution_context,
+                                StateStoragePolicy storage_policy = StateStoragePolicy::TREE_COMPRESSION);
 
-    static std::shared_ptr<SuccessorGenerator<GroundTask>> create(std::shared_ptr<GroundTask> task, ExecutionContextPtr execution_context);
+    static std::shared_ptr<SuccessorGenerator<GroundTask>> create(std::shared_ptr<GroundTask> task,
+                                                                  ExecutionContextPtr execution_context,
+                                                                  StateStoragePolicy storage_policy = StateStoragePolicy::TREE_COMPRESSION);
 
     Node<GroundTask> get_initial_node();
 
     std::vector<LabeledNode<GroundTask>> get_labeled_successor_nodes(const Node<GroundTask>& node);
     void get_labeled_successor_nodes(const Node<GroundTask>& node, std::vector<LabeledNode<GroundTask>>& out_nodes);
 
+    /// @brief Compute the actions that are applicable in the state of the node without creating the successor states.
+    ///
+    /// The successors can be created on demand with `get_successor_node`, e.g., by searches that evaluate them lazily.
+    void get_applicable_actions(const Node<GroundTask>& node, formalism::planning::GroundActionViewList& out_actions);
+
     Node<GroundTask> get_successor_node(const Node<GroundTask>& node, formalism::planning::GroundActionView action);
 
     Node<GroundTask> get_node(Index<State<GroundTask>> state_index);
 
+    /// @brief Return the memory of the state repository and of the workspaces that generate the successors.
+    size_t memory_usage() const noexcept;
+
     /**
      * Expert API
      */
 
     const auto& get_state_repository() const noexcept { return m_state_repository; }
+    const auto& get_perf_counters() const noexcept { return m_perf_counters; }
 
 private:
     std::shared_ptr<GroundTask> m_task;
@@ -61,6 +76,8 @@ private:
     std::shared_ptr<StateRepository<GroundTask>> m_state_repository;
 
     ActionExecutor m_executor;
+
+    PerfCounters m_perf_counters;
 };
 
 }
@@ -52,6 +52,9 @@ public:
         static const auto actions = UnorderedSet<formalism::planning::GroundActionView> {};
         return actions;
     }
+
+    /// @brief Return the estimated memory held by the heuristic, e.g., by its datalog workspace.
+    virtual size_t memory_usage() const { return 0; }
 };
 
 }
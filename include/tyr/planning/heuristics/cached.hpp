@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef TYR_PLANNING_HEURISTICS_CACHED_HPP_
+#define TYR_PLANNING_HEURISTICS_CACHED_HPP_
+
+#include "tyr/common/segmented_vector.hpp"
+#include "tyr/planning/heuristic.hpp"
+
+#include <cstdint>
+#include <limits>
+
+namespace tyr::planning
+{
+
+/// @brief `CachedHeuristic` decorates a heuristic with a cache of h_values and preferred actions indexed by the dense state index.
+///
+/// The cache stays valid as long as all evaluated states are registered in the same `StateRepository`.
+/// Sharing one `CachedHeuristic` between searches that use the same `SuccessorGenerator` therefore avoids recomputation across restarts.
+/// Setting a new goal invalidates the cache.
+template<typename Task>
+class CachedHeuristic : public Heuristic<Task>
+{
+public:
+    CachedHeuristic(std::shared_ptr<const Task> task, HeuristicPtr<Task> heuristic);
+
+    static std::shared_ptr<CachedHeuristic<Task>> create(std::shared_ptr<const Task> task, HeuristicPtr<Task> heuristic);
+
+    void set_goal(formalism::planning::GroundConjunctiveConditionView goal) override;
+
+    float_t evaluate(const StateView<Task>& state) override;
+
+    const UnorderedSet<Index<formalism::planning::GroundAction>>& get_preferred_actions() override;
+
+    const UnorderedSet<formalism::planning::GroundActionView>& get_preferred_action_views() override;
+
+    void clear();
+
+    /**
+     * Getters
+     */
+
+    uint64_t get_num_hits() const noexcept { return m_num_hits; }
+    uint64_t get_num_misses() const noexcept { return m_num_misses; }
+    double get_hit_rate() const noexcept
+    {
+        const auto num_lookups = m_num_hits + m_num_misses;
+        return (num_lookups > 0) ? static_cast<double>(m_num_hits) / num_lookups : 0.;
+    }
+    /// @brief Return the memory of the cache and of the decorated heuristic.
+    size_t memory_usage() const override { return m_entries.memory_usage() + m_preferred_actions_storage.memory_usage() + m_heuristic->memory_usage(); }
+
+private:
+    /// @brief The preferred actions of a state are stored contiguously in `m_preferred_actions_storage`.
+    struct Entry
+    {
+        float_t h_value;
+        uint64_t preferred_actions_begin;
+        uint64_t preferred_actions_end;
+    };
+
+    static constexpr auto UNCACHED_ENTRY =
+        Entry { std::numeric_limits<float_t>::quiet_NaN(), std::numeric_limits<uint64_t>::max(), std::numeric_limits<uint64_t>::max() };
+
+    std::shared_ptr<const Task> m_task;
+    HeuristicPtr<Task> m_heuristic;
+
+    SegmentedVector<Entry> m_entries;
+    SegmentedVector<Index<formalism::planning::GroundAction>> m_preferred_actions_storage;
+
+    UnorderedSet<Index<formalism::planning::GroundAction>> m_preferred_actions;
+    UnorderedSet<formalism::planning::GroundActionView> m_preferred_action_views;
+    bool m_preferred_action_views_dirty;
+
+    uint64_t m_num_hits;
+    uint64_t m_num_misses;
+};
+
+}
+
+#endif
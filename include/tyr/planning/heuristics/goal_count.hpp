@@ -23,6 +23,10 @@
 namespace tyr::planning
 {
 
+/// @brief Return the number of fluent facts, derived literals, and numeric constraints of `goal` that are unsatisfied in `context`.
+template<typename Task>
+float_t count_unsatisfied_goals(formalism::planning::GroundConjunctiveConditionView goal, const StateContext<Task>& context);
+
 template<typename Task>
 class GoalCountHeuristic : public Heuristic<Task>
 {
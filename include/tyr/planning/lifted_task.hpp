@@ -48,6 +48,9 @@ public:
 
     GroundTaskPtr instantiate_ground_task(ExecutionContext& execution_context);
 
+    /// @brief Return the memory of the task repository and of the const program workspaces.
+    size_t memory_usage() const noexcept;
+
     /**
      * Getters
      */
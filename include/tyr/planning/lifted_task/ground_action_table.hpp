@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2025 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef TYR_PLANNING_LIFTED_TASK_GROUND_ACTION_TABLE_HPP_
+#define TYR_PLANNING_LIFTED_TASK_GROUND_ACTION_TABLE_HPP_
+
+#include "tyr/common/declarations.hpp"
+#include "tyr/common/itertools.hpp"
+#include "tyr/formalism/planning/declarations.hpp"
+#include "tyr/formalism/planning/grounder_decl.hpp"
+#include "tyr/formalism/planning/repository.hpp"
+#include "tyr/planning/declarations.hpp"
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace tyr::planning
+{
+
+/// @brief `GroundActionTable` memoizes the ground action of each pair of action schema and binding.
+///
+/// A binding is encoded as a mixed-radix number over the objects of the task, so that a re-encountered ground action
+/// is found with a single hash lookup instead of grounding, canonicalizing, and interning the action schema again.
+/// Bindings whose encoding does not fit into 64 bits are grounded every time.
+class GroundActionTable
+{
+public:
+    explicit GroundActionTable(LiftedTask& task);
+
+    /// @brief Return the ground action of `action` under the binding in `context.binding`, grounding it on the first encounter.
+    /// @param action is the action schema.
+    /// @param context is the grounder context whose binding holds the objects of the parameters of `action`.
+    /// @param assign is a workspace for grounding.
+    /// @param iter_workspace is a workspace for grounding.
+    /// @return the ground action.
+    formalism::planning::GroundActionView
+    get_or_create(formalism::planning::ActionView action,
+                  formalism::planning::GrounderContext& context,
+                  UnorderedMap<Index<formalism::planning::FDRVariable<formalism::FluentTag>>, formalism::planning::FDRValue>& assign,
+                  itertools::cartesian_set::Workspace<Index<formalism::Object>>& iter_workspace);
+
+    void clear() noexcept;
+
+    size_t size() const noexcept;
+    uint64_t get_num_hits() const noexcept { return m_num_hits; }
+    uint64_t get_num_misses() const noexcept { return m_num_misses; }
+    size_t memory_usage() const noexcept;
+
+private:
+    std::optional<uint64_t> encode(const IndexList<formalism::Object>& binding) const noexcept;
+
+    LiftedTask* m_task;
+
+    uint64_t m_radix;
+    size_t m_max_arity;  ///< The maximum binding length whose encoding fits into 64 bits
+
+    std::vector<UnorderedMap<uint64_t, Index<formalism::planning::GroundAction>>> m_tables;  ///< Indexed by action schema
+
+    uint64_t m_num_hits;
+    uint64_t m_num_misses;
+};
+
+}
+
+#endif
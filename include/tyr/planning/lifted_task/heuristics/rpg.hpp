@@ -19,6 +19,7 @@
 #define TYR_PLANNING_LIFTED_TASK_HEURISTICS_RPG_HPP_
 
 #include "tyr/common/onetbb.hpp"
+#include "tyr/common/trace.hpp"
 #include "tyr/datalog/bottom_up.hpp"
 #include "tyr/datalog/contexts/program.hpp"
 #include "tyr/datalog/workspaces/program.hpp"
@@ -54,21 +55,28 @@ public:
         m_workspace.facts.goal_fact_sets.reset();
 
         auto merge_context = formalism::planning::MergeDatalogContext { m_workspace.datalog_builder, m_workspace.workspace_repository };
+        auto& atom_translation_table = m_task->get_rpg_program().get_atom_translation_table();
 
         for (const auto fact : goal.get_facts<formalism::FluentTag>())
         {
             if (fact.get_atom())
-                m_workspace.facts.goal_fact_sets.insert(formalism::planning::merge_p2d(fact.get_atom().value(), merge_context).first);
+                m_workspace.facts.goal_fact_sets.insert(atom_translation_table.to_datalog(fact.get_atom().value(), merge_context));
         }
     }
 
     float_t evaluate(const StateView<LiftedTask>& state) override
     {
+        const auto heuristic_trace = trace::TraceScope("evaluate_heuristic", "search");
+
         m_workspace.facts.reset();
 
         auto merge_context = formalism::planning::MergeDatalogContext { m_workspace.datalog_builder, m_workspace.workspace_repository };
 
-        insert_fluent_atoms_to_fact_set(state.get_unpacked_state(), *m_task->get_repository(), merge_context, m_workspace.facts.fact_sets);
+        insert_fluent_atoms_to_fact_set(state.get_unpacked_state(),
+                                        *m_task->get_repository(),
+                                        m_task->get_rpg_program().get_atom_translation_table(),
+                                        merge_context,
+                                        m_workspace.facts.fact_sets);
 
         auto ctx = datalog::ProgramExecutionContext(m_workspace, m_task->get_rpg_program().get_const_program_workspace());
         ctx.clear();
@@ -78,6 +86,8 @@ public:
         return (m_workspace.tp.check()) ? self().extract_cost_and_set_preferred_actions_impl(state) : std::numeric_limits<float_t>::infinity();
     }
 
+    size_t memory_usage() const override { return m_workspace.get_memory_statistics().total(); }
+
     const auto& get_workspace() const noexcept { return m_workspace; }
 
 protected:
@@ -35,11 +35,16 @@ class AddRPGHeuristic<LiftedTask> :
                    datalog::TerminationPolicy<datalog::SumAggregation>>
 {
 public:
-    AddRPGHeuristic(std::shared_ptr<LiftedTask> task, ExecutionContextPtr execution_context);
+    /// @brief Create the heuristic, which charges each action its cost lower bound instead of unit cost if `use_action_costs` is set.
+    AddRPGHeuristic(std::shared_ptr<LiftedTask> task, ExecutionContextPtr execution_context, bool use_action_costs = false);
 
-    static std::shared_ptr<AddRPGHeuristic<LiftedTask>> create(std::shared_ptr<LiftedTask> task, ExecutionContextPtr execution_context);
+    static std::shared_ptr<AddRPGHeuristic<LiftedTask>>
+    create(std::shared_ptr<LiftedTask> task, ExecutionContextPtr execution_context, bool use_action_costs = false);
 
     float_t extract_cost_and_set_preferred_actions_impl(const StateView<LiftedTask>& state);
+
+private:
+    float_t m_action_cost_scale;
 };
 
 }
@@ -27,6 +27,7 @@
 #include "tyr/formalism/planning/merge_datalog.hpp"
 #include "tyr/planning/applicability.hpp"
 #include "tyr/planning/heuristics/rpg_ff.hpp"
+#include "tyr/planning/lifted_task/ground_action_table.hpp"
 #include "tyr/planning/lifted_task/heuristics/rpg.hpp"
 
 #include <boost/dynamic_bitset.hpp>
@@ -43,9 +44,11 @@ class FFRPGHeuristic<LiftedTask> :
                    datalog::TerminationPolicy<datalog::SumAggregation>>
 {
 public:
-    FFRPGHeuristic(std::shared_ptr<LiftedTask> task, ExecutionContextPtr execution_context);
+    /// @brief Create the heuristic, which sums the action cost lower bounds instead of counting the actions of the relaxed plan if `use_action_costs` is set.
+    FFRPGHeuristic(std::shared_ptr<LiftedTask> task, ExecutionContextPtr execution_context, bool use_action_costs = false);
 
-    static std::shared_ptr<FFRPGHeuristic<LiftedTask>> create(std::shared_ptr<LiftedTask> task, ExecutionContextPtr execution_context);
+    static std::shared_ptr<FFRPGHeuristic<LiftedTask>>
+    create(std::shared_ptr<LiftedTask> task, ExecutionContextPtr execution_context, bool use_action_costs = false);
 
     float_t extract_cost_and_set_preferred_actions_impl(const StateView<LiftedTask>& state);
 
@@ -55,21 +58,27 @@ public:
 
     bool mark_atom(formalism::datalog::PredicateBindingView<formalism::FluentTag> atom);
 
+    const auto& get_ground_action_table() const noexcept { return m_ground_action_table; }
+
 private:
     void extract_relaxed_plan_and_preferred_actions(formalism::datalog::PredicateBindingView<formalism::FluentTag> atom,
                                                     const StateContext<LiftedTask>& state_context,
                                                     formalism::planning::GrounderContext& grounder_context);
 
 private:
+    bool m_use_action_costs;
+
     std::vector<boost::dynamic_bitset<>> m_markings;
 
     /// For grounding actions
     IndexList<formalism::Object> m_binding;
     UnorderedMap<Index<formalism::planning::FDRVariable<formalism::FluentTag>>, formalism::planning::FDRValue> m_assign;
     itertools::cartesian_set::Workspace<Index<formalism::Object>> m_iter_workspace;
+    GroundActionTable m_ground_action_table;
     formalism::planning::EffectFamilyList m_effect_families;
 
     UnorderedSet<Index<formalism::planning::GroundAction>> m_relaxed_plan;
+    float_t m_relaxed_plan_cost;
     UnorderedSet<Index<formalism::planning::GroundAction>> m_preferred_actions;
     UnorderedSet<formalism::planning::GroundActionView> m_preferred_action_views;
     bool m_preferred_action_views_dirty;
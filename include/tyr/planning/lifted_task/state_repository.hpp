@@ -20,6 +20,7 @@
 
 #include "tyr/common/config.hpp"
 #include "tyr/common/indexed_hash_set.hpp"
+#include "tyr/common/perf_counters.hpp"
 #include "tyr/common/onetbb.hpp"
 #include "tyr/common/shared_object_pool.hpp"
 #include "tyr/planning/lifted_task/state_data.hpp"
@@ -33,6 +34,7 @@
 #include "tyr/planning/lifted_task/state_storage/tree_compression/fact.hpp"
 #include "tyr/planning/state_storage/config.hpp"
 #include "tyr/planning/state_storage/hash_set/numeric.hpp"
+#include "tyr/planning/state_storage/storage.hpp"
 #include "tyr/planning/state_storage/tree_compression/numeric.hpp"
 
 #include <memory>
@@ -46,9 +48,13 @@ template<>
 class StateRepository<LiftedTask> : public std::enable_shared_from_this<StateRepository<LiftedTask>>
 {
 public:
-    explicit StateRepository(std::shared_ptr<LiftedTask> task, ExecutionContextPtr execution_context);
+    explicit StateRepository(std::shared_ptr<LiftedTask> task,
+                             ExecutionContextPtr execution_context,
+                             StateStoragePolicy storage_policy = StateStoragePolicy::TREE_COMPRESSION);
 
-    static std::shared_ptr<StateRepository<LiftedTask>> create(std::shared_ptr<LiftedTask> task, ExecutionContextPtr execution_context);
+    static std::shared_ptr<StateRepository<LiftedTask>> create(std::shared_ptr<LiftedTask> task,
+                                                               ExecutionContextPtr execution_context,
+                                                               StateStoragePolicy storage_policy = StateStoragePolicy::TREE_COMPRESSION);
 
     StateView<LiftedTask> get_initial_state();
 
@@ -65,22 +71,24 @@ public:
 
     StateView<LiftedTask> register_state(SharedObjectPoolPtr<UnpackedState<LiftedTask>> state);
 
+    size_t get_num_states() const noexcept;
+
     size_t memory_usage() const noexcept;
 
     const auto& get_task() const noexcept { return m_task; }
+    StateStoragePolicy get_storage_policy() const noexcept { return m_storage_policy; }
     const auto& get_axiom_evaluator() const noexcept { return m_axiom_evaluator; }
+    const auto& get_register_state_perf_counters() const noexcept { return m_register_state_perf_counters; }
 
 private:
     std::shared_ptr<LiftedTask> m_task;
 
-    StateStorageContext<LiftedTask, StateStoragePolicyTag> m_context;
-    FactStorageBackend<LiftedTask, StateStoragePolicyTag> m_fluent_backend;
-    AtomStorageBackend<LiftedTask, StateStoragePolicyTag> m_derived_backend;
-    NumericStorageBackend<LiftedTask, StateStoragePolicyTag> m_numeric_backend;
-
-    IndexedHashSet<State<LiftedTask>> m_packed_states;
+    StateStoragePolicy m_storage_policy;
+    StateStorageVariant<LiftedTask> m_storage;
     SharedObjectPool<UnpackedState<LiftedTask>> m_unpacked_state_pool;
 
+    PerfCounters m_register_state_perf_counters;
+
     std::shared_ptr<AxiomEvaluator<LiftedTask>> m_axiom_evaluator;
 };
 
@@ -19,6 +19,7 @@
 #define TYR_PLANNING_LIFTED_TASK_SUCCESSOR_GENERATOR_HPP_
 
 #include "tyr/common/onetbb.hpp"
+#include "tyr/common/perf_counters.hpp"
 #include "tyr/datalog/policies/annotation.hpp"
 #include "tyr/datalog/policies/termination.hpp"
 #include "tyr/datalog/workspaces/program.hpp"
@@ -27,8 +28,10 @@
 #include "tyr/planning/declarations.hpp"
 #include "tyr/planning/ground_task/match_tree/declarations.hpp"  // for Matc...
 #include "tyr/planning/lifted_task/axiom_evaluator.hpp"
+#include "tyr/planning/lifted_task/ground_action_table.hpp"
 #include "tyr/planning/lifted_task/node.hpp"
 #include "tyr/planning/lifted_task/state_repository.hpp"
+#include "tyr/planning/state_storage/config.hpp"
 #include "tyr/planning/successor_generator.hpp"
 
 namespace tyr::planning
@@ -38,27 +41,43 @@ template<>
 class SuccessorGenerator<LiftedTask>
 {
 public:
-    explicit SuccessorGenerator(std::shared_ptr<LiftedTask> task, ExecutionContextPtr execution_context);
+    explicit SuccessorGenerator(std::shared_ptr<LiftedTask> task,
+                                ExecutionContextPtr execution_context,
+                                StateStoragePolicy storage_policy = StateStoragePolicy::TREE_COMPRESSION);
 
-    static std::shared_ptr<SuccessorGenerator<LiftedTask>> create(std::shared_ptr<LiftedTask> task, ExecutionContextPtr execution_context);
+    static std::shared_ptr<SuccessorGenerator<LiftedTask>> create(std::shared_ptr<LiftedTask> task,
+                                                                  ExecutionContextPtr execution_context,
+                                                                  StateStoragePolicy storage_policy = StateStoragePolicy::TREE_COMPRESSION);
 
     Node<LiftedTask> get_initial_node();
 
     std::vector<LabeledNode<LiftedTask>> get_labeled_successor_nodes(const Node<LiftedTask>& node);
     void get_labeled_successor_nodes(const Node<LiftedTask>& node, std::vector<LabeledNode<LiftedTask>>& out_nodes);
 
+    /// @brief Compute the actions that are applicable in the state of the node without creating the successor states.
+    ///
+    /// The successors can be created on demand with `get_successor_node`, e.g., by searches that evaluate them lazily.
+    void get_applicable_actions(const Node<LiftedTask>& node, formalism::planning::GroundActionViewList& out_actions);
+
     Node<LiftedTask> get_successor_node(const Node<LiftedTask>& node, formalism::planning::GroundActionView action);
 
     Node<LiftedTask> get_node(Index<State<LiftedTask>> state_index);
 
+    /// @brief Return the memory of the state repository and of the workspaces that generate the successors.
+    size_t memory_usage() const noexcept;
+
     /**
      * Expert API
      */
 
     const auto& get_state_repository() const noexcept { return m_state_repository; }
+    const auto& get_perf_counters() const noexcept { return m_perf_counters; }
     const auto& get_workspace() const noexcept { return m_workspace; }
+    const auto& get_ground_action_table() const noexcept { return m_ground_action_table; }
 
 private:
+    void compute_applicable_actions(const StateContext<LiftedTask>& state_context, formalism::planning::GroundActionViewList& out_actions);
+
     std::shared_ptr<LiftedTask> m_task;
     ExecutionContextPtr m_execution_context;
 
@@ -67,6 +86,12 @@ private:
     std::shared_ptr<StateRepository<LiftedTask>> m_state_repository;
 
     ActionExecutor m_executor;
+
+    GroundActionTable m_ground_action_table;
+
+    formalism::planning::GroundActionViewList m_applicable_actions;
+
+    PerfCounters m_perf_counters;
 };
 
 }
@@ -18,13 +18,23 @@
 #ifndef TYR_PLANNING_PLANNING_HPP_
 #define TYR_PLANNING_PLANNING_HPP_
 
+#include "tyr/planning/algorithms/anytime.hpp"
+#include "tyr/planning/algorithms/anytime/event_handler.hpp"
 #include "tyr/planning/algorithms/astar_eager.hpp"
 #include "tyr/planning/algorithms/astar_eager/event_handler.hpp"
+#include "tyr/planning/algorithms/bfws.hpp"
+#include "tyr/planning/algorithms/bfws/event_handler.hpp"
 #include "tyr/planning/algorithms/gbfs_lazy.hpp"
 #include "tyr/planning/algorithms/gbfs_lazy/event_handler.hpp"
+#include "tyr/planning/algorithms/iw.hpp"
+#include "tyr/planning/algorithms/iw/event_handler.hpp"
+#include "tyr/planning/algorithms/novelty.hpp"
+#include "tyr/planning/algorithms/progress.hpp"
+#include "tyr/planning/algorithms/siw.hpp"
 #include "tyr/planning/algorithms/statistics.hpp"
 #include "tyr/planning/algorithms/strategies/goal.hpp"
 #include "tyr/planning/algorithms/strategies/pruning.hpp"
+#include "tyr/planning/algorithms/strategies/symmetry.hpp"
 #include "tyr/planning/declarations.hpp"
 #include "tyr/planning/formatter.hpp"
 #include "tyr/planning/ground_task.hpp"
@@ -37,6 +47,7 @@
 #include "tyr/planning/ground_task/successor_generator.hpp"
 #include "tyr/planning/ground_task/unpacked_state.hpp"
 #include "tyr/planning/heuristics/blind.hpp"
+#include "tyr/planning/heuristics/cached.hpp"
 #include "tyr/planning/heuristics/goal_count.hpp"
 #include "tyr/planning/lifted_task.hpp"
 #include "tyr/planning/lifted_task/axiom_evaluator.hpp"
@@ -52,6 +63,7 @@
 #include "tyr/planning/lifted_task/unpacked_state.hpp"
 #include "tyr/planning/plan.hpp"
 #include "tyr/planning/programs/action.hpp"
+#include "tyr/planning/programs/atom_translation_table.hpp"
 #include "tyr/planning/programs/axiom.hpp"
 #include "tyr/planning/programs/ground.hpp"
 #include "tyr/planning/search_node.hpp"
@@ -59,5 +71,6 @@
 #include "tyr/planning/state_index.hpp"
 #include "tyr/planning/state_iterators.hpp"
 #include "tyr/planning/state_repository.hpp"
+#include "tyr/planning/symmetries.hpp"
 
 #endif
@@ -27,6 +27,7 @@
 #include "tyr/formalism/planning/repository.hpp"
 #include "tyr/formalism/planning/views.hpp"
 #include "tyr/planning/declarations.hpp"
+#include "tyr/planning/programs/atom_translation_table.hpp"
 
 namespace tyr::planning
 {
@@ -43,6 +44,8 @@ public:
     datalog::ProgramContext& get_program_context() noexcept;
     const datalog::ProgramContext& get_program_context() const noexcept;
     const datalog::ConstProgramWorkspace& get_const_program_workspace() const noexcept;
+    AtomTranslationTable& get_atom_translation_table() noexcept;
+    const AtomTranslationTable& get_atom_translation_table() const noexcept;
 
 private:
     AppPredicateToActionsMapping m_predicate_to_actions;
@@ -50,6 +53,8 @@ private:
     datalog::ProgramContext m_program_context;
 
     datalog::ConstProgramWorkspace m_program_workspace;
+
+    AtomTranslationTable m_atom_translation_table;
 };
 
 }
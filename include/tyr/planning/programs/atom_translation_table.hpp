@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2025 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef TYR_PLANNING_PROGRAMS_ATOM_TRANSLATION_TABLE_HPP_
+#define TYR_PLANNING_PROGRAMS_ATOM_TRANSLATION_TABLE_HPP_
+
+#include "tyr/common/declarations.hpp"
+#include "tyr/formalism/binding_index.hpp"
+#include "tyr/formalism/datalog/repository.hpp"
+#include "tyr/formalism/planning/merge_datalog_decl.hpp"
+#include "tyr/formalism/planning/merge_planning_decl.hpp"
+#include "tyr/formalism/planning/repository.hpp"
+
+#include <vector>
+
+namespace tyr::planning
+{
+
+/// @brief `AtomTranslationTable` memoizes the translation of ground atoms between the task and the datalog program.
+///
+/// The datalog bindings live in the workspace repository of a program, which is never cleared, and the planning ground atoms
+/// live in the task repository. Hence, the correspondence is fixed once both sides exist, and the table replaces merging,
+/// canonicalizing, and interning an atom by an array load. The tables are dense, indexed by the planning ground atom,
+/// respectively by the datalog relation and row, and grow lazily.
+class AtomTranslationTable
+{
+public:
+    /// @brief Return the datalog binding of the planning ground atom, merging it into `context.destination` on the first encounter.
+    /// @param atom is the fluent or derived planning ground atom.
+    /// @param context is the merge context whose destination is the workspace repository of the program.
+    /// @return the datalog binding.
+    template<formalism::FactKind T>
+    formalism::datalog::PredicateBindingView<formalism::FluentTag> to_datalog(formalism::planning::GroundAtomView<T> atom,
+                                                                             formalism::planning::MergeDatalogContext& context);
+
+    /// @brief Return the derived planning ground atom of the datalog binding, merging it into `context.destination` on the first encounter.
+    /// @param binding is the datalog binding of a derived predicate.
+    /// @param context is the merge context whose destination is the task repository.
+    /// @return the derived planning ground atom.
+    formalism::planning::GroundAtomView<formalism::DerivedTag> to_planning(formalism::datalog::PredicateBindingView<formalism::FluentTag> binding,
+                                                                           formalism::planning::MergePlanningContext& context);
+
+    void clear() noexcept;
+
+    size_t memory_usage() const noexcept;
+
+private:
+    using DatalogBinding = Index<formalism::RelationBinding<formalism::Predicate<formalism::FluentTag>>>;
+
+    template<formalism::FactKind T>
+    std::vector<DatalogBinding>& get_p2d_table() noexcept;
+
+    std::vector<DatalogBinding> m_fluent_p2d;  ///< Indexed by Index<GroundAtom<FluentTag>>
+    std::vector<DatalogBinding> m_derived_p2d;  ///< Indexed by Index<GroundAtom<DerivedTag>>
+    std::vector<std::vector<Index<formalism::planning::GroundAtom<formalism::DerivedTag>>>> m_derived_d2p;  ///< Indexed by relation and row
+};
+
+}
+
+#endif
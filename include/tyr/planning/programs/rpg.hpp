@@ -27,6 +27,10 @@
 #include "tyr/formalism/planning/repository.hpp"
 #include "tyr/formalism/planning/views.hpp"
 #include "tyr/planning/declarations.hpp"
+#include "tyr/planning/programs/atom_translation_table.hpp"
+
+#include <memory>
+#include <vector>
 
 namespace tyr::planning
 {
@@ -39,16 +43,31 @@ public:
     explicit RPGProgram(formalism::planning::TaskView task);
 
     const RuleToActionMapping& get_rule_to_action_mapping() const noexcept;
+    /// @brief Get a lower bound on the cost of the action of each rule, indexed by rule index.
+    /// The lower bound is exact for constant costs and the least static value for costs given by a static function term.
+    const std::vector<float_t>& get_rule_action_costs() const noexcept;
+    /// @brief Get the factor that maps the rule action costs to the integral costs of `get_scaled_rule_action_costs`.
+    float_t get_action_cost_scale() const noexcept;
+    /// @brief Get the rule action costs multiplied by the action cost scale, suitable for `datalog::AndAnnotationPolicy`.
+    const std::shared_ptr<const std::vector<datalog::Cost>>& get_scaled_rule_action_costs() const noexcept;
     datalog::ProgramContext& get_program_context() noexcept;
     const datalog::ProgramContext& get_program_context() const noexcept;
     const datalog::ConstProgramWorkspace& get_const_program_workspace() const noexcept;
+    AtomTranslationTable& get_atom_translation_table() noexcept;
+    const AtomTranslationTable& get_atom_translation_table() const noexcept;
 
 private:
     RuleToActionMapping m_rule_to_action;
+    std::vector<float_t> m_rule_action_costs;
 
     datalog::ProgramContext m_program_context;
 
+    float_t m_action_cost_scale;
+    std::shared_ptr<const std::vector<datalog::Cost>> m_scaled_rule_action_costs;
+
     datalog::ConstProgramWorkspace m_program_workspace;
+
+    AtomTranslationTable m_atom_translation_table;
 };
 
 }
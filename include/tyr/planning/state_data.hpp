@@ -29,10 +29,10 @@
 
 namespace tyr
 {
-template<typename Task>
-class Data<planning::State<Task>>
+template<typename Task, typename Tag>
+class Data<planning::PackedState<Task, Tag>>
 {
-    static_assert(dependent_false<Task>::value, "Data<State<Task>> is not defined for type T.");
+    static_assert(dependent_false<Task>::value, "Data<PackedState<Task, Tag>> is not defined for type T.");
 };
 }
 
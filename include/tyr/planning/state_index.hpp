@@ -31,6 +31,14 @@ struct Index<planning::State<Task>> : IndexMixin<Index<planning::State<Task>>>
     using Base = IndexMixin<Index<planning::State<Task>>>;
     using Base::Base;
 };
+
+template<typename Task, typename Tag>
+struct Index<planning::PackedState<Task, Tag>> : IndexMixin<Index<planning::PackedState<Task, Tag>>>
+{
+    // Inherit constructors
+    using Base = IndexMixin<Index<planning::PackedState<Task, Tag>>>;
+    using Base::Base;
+};
 }
 
 #endif
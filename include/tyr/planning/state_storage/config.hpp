@@ -22,13 +22,13 @@
 
 namespace tyr::planning
 {
-#if defined(TYR_STATE_STORAGE_TREE)
-using StateStoragePolicyTag = TreeCompression;
-#elif defined(TYR_STATE_STORAGE_HASHSET)
-using StateStoragePolicyTag = HashSet;
-#else
-#error "No lifted state storage policy selected"
-#endif
+/// @brief Selects the state storage backend of a `StateRepository` at runtime.
+/// TREE_COMPRESSION is memory-lean, HASH_SET is faster to register and unpack.
+enum class StateStoragePolicy
+{
+    TREE_COMPRESSION,
+    HASH_SET
+};
 }
 
 #endif
@@ -0,0 +1,79 @@
+/*
+ * Copyright (C) 2025 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef TYR_PLANNING_STATE_STORAGE_STORAGE_HPP_
+#define TYR_PLANNING_STATE_STORAGE_STORAGE_HPP_
+
+#include "tyr/common/config.hpp"
+#include "tyr/common/indexed_hash_set.hpp"
+#include "tyr/planning/declarations.hpp"
+#include "tyr/planning/state_data.hpp"
+#include "tyr/planning/state_index.hpp"
+#include "tyr/planning/state_storage.hpp"
+#include "tyr/planning/state_storage/config.hpp"
+#include "tyr/planning/state_storage/tags.hpp"
+
+#include <variant>
+
+namespace tyr::planning
+{
+
+/// @brief `StateStorage` bundles the context, the backends, and the packed states of a single storage policy `Tag`.
+///
+/// The backends keep references into the context, hence the storage is neither copyable nor movable.
+template<typename Task, typename Tag>
+class StateStorage
+{
+public:
+    explicit StateStorage(const Task& task);
+    StateStorage(const StateStorage& other) = delete;
+    StateStorage& operator=(const StateStorage& other) = delete;
+    StateStorage(StateStorage&& other) = delete;
+    StateStorage& operator=(StateStorage&& other) = delete;
+
+    /// @brief Packs the given `state` and returns the index of the packed state.
+    Index<State<Task>> insert(const UnpackedState<Task>& state);
+
+    /// @brief Unpacks the packed state with the given `index` into `state`.
+    void unpack(Index<State<Task>> index, UnpackedState<Task>& state);
+
+    size_t size() const noexcept { return m_packed_states.size(); }
+
+    size_t memory_usage() const noexcept { return m_context.memory_usage() + m_packed_states.memory_usage(); }
+
+private:
+    StateStorageContext<Task, Tag> m_context;
+    FactStorageBackend<Task, Tag> m_fluent_backend;
+    AtomStorageBackend<Task, Tag> m_derived_backend;
+    NumericStorageBackend<Task, Tag> m_numeric_backend;
+
+    IndexedHashSet<PackedState<Task, Tag>> m_packed_states;
+};
+
+/// @brief All storage policies compiled into the library.
+///
+/// Dispatch happens once per registered or unpacked state via `std::visit` over a closed set of alternatives,
+/// which compiles to a jump table instead of a virtual call.
+template<typename Task>
+using StateStorageVariant = std::variant<StateStorage<Task, TreeCompression>, StateStorage<Task, HashSet>>;
+
+template<typename Task>
+StateStorageVariant<Task> create_state_storage(const Task& task, StateStoragePolicy policy);
+
+}
+
+#endif
@@ -20,6 +20,7 @@
 
 #include "tyr/common/declarations.hpp"
 #include "tyr/common/onetbb.hpp"
+#include "tyr/formalism/planning/repository.hpp"
 #include "tyr/planning/declarations.hpp"
 #include "tyr/planning/node.hpp"
 #include "tyr/planning/state_index.hpp"
@@ -40,10 +41,12 @@ concept SuccessorGeneratorConcept = requires(T& r,
                                              Index<State<Task>> state_index,
                                              const Node<Task>& node,
                                              std::vector<LabeledNode<Task>>& labeled_successor_nodes,
+                                             formalism::planning::GroundActionViewList& applicable_actions,
                                              formalism::planning::GroundActionView action) {
     { r.get_initial_node() } -> std::same_as<Node<Task>>;
     { r.get_labeled_successor_nodes(node) } -> std::same_as<std::vector<LabeledNode<Task>>>;
     { r.get_labeled_successor_nodes(node, labeled_successor_nodes) } -> std::same_as<void>;
+    { r.get_applicable_actions(node, applicable_actions) } -> std::same_as<void>;
     { r.get_successor_node(node, action) } -> std::same_as<Node<Task>>;
     { r.get_node(state_index) } -> std::same_as<Node<Task>>;
 };
@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2025 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef TYR_PLANNING_SYMMETRIES_HPP_
+#define TYR_PLANNING_SYMMETRIES_HPP_
+
+#include "tyr/common/config.hpp"
+#include "tyr/common/types.hpp"
+#include "tyr/formalism/declarations.hpp"
+#include "tyr/planning/declarations.hpp"
+#include "tyr/planning/state_view.hpp"
+
+#include <span>
+#include <vector>
+
+namespace tyr::planning
+{
+
+/// @brief `ObjectHypergraph` is a hypergraph over objects whose edges are stored contiguously.
+///
+/// Edge i occupies [offsets[i], offsets[i + 1]) of data and is laid out as [h, header_1, ..., header_h, object_1, ..., object_k].
+struct ObjectHypergraph
+{
+    std::vector<uint_t> data;
+    std::vector<uint_t> offsets = { 0 };
+    std::vector<std::vector<uint_t>> incident_edges;  ///< The indices of the edges that contain each object.
+
+    /// @brief Remove all edges while keeping the allocated buffers.
+    void clear(size_t num_objects);
+
+    void add_edge(std::span<const uint_t> edge);
+
+    size_t get_num_edges() const noexcept { return offsets.size() - 1; }
+    std::span<const uint_t> get_edge(size_t index) const noexcept { return { data.data() + offsets[index], data.data() + offsets[index + 1] }; }
+};
+
+/// @brief `ObjectSymmetriesWorkspace` holds the buffers of color refinement and state key computation such that they are reused across calls.
+struct ObjectSymmetriesWorkspace
+{
+    ObjectHypergraph graph;
+    std::vector<uint_t> edge;
+    std::vector<uint_t> colors;
+    std::vector<uint_t> sorted_colors;
+    std::vector<uint_t> order;
+    std::vector<std::vector<uint_t>> signatures;
+    std::vector<uint_t> occurrence_data;
+    std::vector<uint_t> occurrence_offsets;
+    std::vector<uint_t> occurrence_order;
+    std::vector<uint_t> permutation;
+    std::vector<uint_t> members;
+};
+
+/// @brief `ObjectSymmetries` stores classes of interchangeable objects of a task.
+///
+/// The structural symmetries are computed on an object-colored hypergraph over the static atoms, the static function values, and the goal.
+/// Objects that occur in the domain, in the axioms of the task, or in numeric goal constraints and the metric are fixed.
+/// Color refinement partitions the remaining objects, and two objects of the same color are merged into a class
+/// if swapping them maps the hypergraph onto itself. Every permutation within a class is then an automorphism of the task,
+/// i.e., it maps applicable actions to applicable actions, successors to successors, and goal states to goal states.
+class ObjectSymmetries
+{
+public:
+    ObjectSymmetries() = default;
+
+    template<typename Task>
+    explicit ObjectSymmetries(const Task& task);
+
+    /// @brief Compute a key of the given state such that two states with the same key are symmetric.
+    ///
+    /// The key is the set of fluent atoms and fluent function values of a symmetric image of the state,
+    /// obtained by ordering the objects of each class by their color under refinement with the state's facts.
+    /// Symmetric states usually obtain the same key, ties in the refined colors might lead to different keys.
+    /// The key is written to `out_key`, and the buffers of `workspace` are reused to avoid allocations per state.
+    template<typename Task>
+    void compute_state_key(const StateView<Task>& state, ObjectSymmetriesWorkspace& workspace, std::vector<uint_t>& out_key) const;
+
+    /// @brief Return true iff the task has no pair of interchangeable objects.
+    bool empty() const noexcept { return m_classes.empty(); }
+
+    /// @brief Return the classes of interchangeable objects, each sorted by index and of size at least two.
+    const std::vector<IndexList<formalism::Object>>& get_classes() const noexcept { return m_classes; }
+
+    /// @brief Return the number of transpositions that generate the symmetry group.
+    size_t get_num_generators() const noexcept;
+
+private:
+    std::vector<IndexList<formalism::Object>> m_classes;
+    std::vector<uint_t> m_colors;  ///< Color of each object after refinement on the task structure.
+};
+
+}
+
+#endif
@@ -25,6 +25,7 @@
 #include "tyr/formalism/planning/merge_datalog_decl.hpp"
 #include "tyr/formalism/planning/repository.hpp"
 #include "tyr/planning/lifted_task/unpacked_state.hpp"
+#include "tyr/planning/programs/atom_translation_table.hpp"
 
 namespace tyr::planning
 {
@@ -33,6 +34,7 @@ namespace tyr::planning
 
 extern void insert_fluent_atoms_to_fact_set(const UnpackedState<LiftedTask>& state,
                                             const formalism::planning::Repository& repository,
+                                            AtomTranslationTable& atom_translation_table,
                                             formalism::planning::MergeDatalogContext& merge_context,
                                             datalog::TaggedFactSets<formalism::FluentTag>& fact_sets);
 
@@ -110,6 +110,7 @@ void bind_module_definitions(nb::module_& m)
 
     {
         auto cls = nb::class_<Repository>(m, "Repository")  //
+                       .def("memory_usage", &Repository::memory_usage)
                        .def(
                            "create",
                            [](Repository& self, const Data<Term>& builder) { return make_view(builder, self); },
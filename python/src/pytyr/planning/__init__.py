@@ -2,6 +2,7 @@
 
 from pytyr.pytyr.planning import (
     SearchStatus,
+    StateStoragePolicy,
 )
 
 from . import (
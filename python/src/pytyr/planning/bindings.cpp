@@ -42,6 +42,15 @@ void bind_module_definitions(nb::module_& m)
         .value("UNSOLVABLE", SearchStatus::UNSOLVABLE)
         .export_values();
 
+    /**
+     * StateStoragePolicy
+     */
+
+    nb::enum_<StateStoragePolicy>(m, "StateStoragePolicy")
+        .value("TREE_COMPRESSION", StateStoragePolicy::TREE_COMPRESSION)
+        .value("HASH_SET", StateStoragePolicy::HASH_SET)
+        .export_values();
+
     /**
      * Statistics
      */
@@ -55,7 +64,10 @@ void bind_ground_module_definitions(nb::module_& m)
         .def("get_formalism_task", &GroundTask::get_formalism_task)
         .def("get_repository", &GroundTask::get_repository)
         .def("get_task", &GroundTask::get_task)
-        .def("get_fdr_context", &GroundTask::get_fdr_context);
+        .def("get_fdr_context", &GroundTask::get_fdr_context)
+        .def("memory_usage", &GroundTask::memory_usage)
+        .def("save", &GroundTask::save, "filepath"_a)
+        .def_static("load_mmap", &GroundTask::load_mmap, "filepath"_a);
 
     bind_index<Index<State<GroundTask>>>(m, "StateIndex");
     bind_state<GroundTask>(m, "State");
@@ -69,9 +81,11 @@ void bind_ground_module_definitions(nb::module_& m)
     bind_goal_strategy<GroundTask>(m, "GoalStrategy");
     bind_task_goal_strategy<GroundTask>(m, "TaskGoalStrategy");
     bind_pruning_strategy<GroundTask>(m, "PruningStrategy");
+    bind_symmetry_pruning_strategy<GroundTask>(m, "SymmetryPruningStrategy");
     bind_heuristic<GroundTask>(m, "Heuristic");
     bind_blind_heuristic<GroundTask>(m, "BlindHeuristic");
     bind_goal_count_heuristic<GroundTask>(m, "GoalCountHeuristic");
+    bind_cached_heuristic<GroundTask>(m, "CachedHeuristic");
 }
 
 void bind_lifted_module_definitions(nb::module_& m)
@@ -97,7 +111,8 @@ should not be used further.
         .def("get_repository", &LiftedTask::get_repository)
         .def("get_task", &LiftedTask::get_task)
         .def("get_fdr_context", nb::overload_cast<>(&LiftedTask::get_fdr_context, nb::const_))
-        .def("instantiate_ground_task", &LiftedTask::instantiate_ground_task);
+        .def("instantiate_ground_task", &LiftedTask::instantiate_ground_task)
+        .def("memory_usage", &LiftedTask::memory_usage);
 
     bind_index<Index<State<LiftedTask>>>(m, "StateIndex");
     bind_state<LiftedTask>(m, "State");
@@ -111,12 +126,14 @@ should not be used further.
     bind_goal_strategy<LiftedTask>(m, "GoalStrategy");
     bind_task_goal_strategy<LiftedTask>(m, "TaskGoalStrategy");
     bind_pruning_strategy<LiftedTask>(m, "PruningStrategy");
+    bind_symmetry_pruning_strategy<LiftedTask>(m, "SymmetryPruningStrategy");
     bind_heuristic<LiftedTask>(m, "Heuristic");
     bind_blind_heuristic<LiftedTask>(m, "BlindHeuristic");
     bind_rpg_max_heuristic<LiftedTask>(m, "MaxRPGHeuristic");
     bind_rpg_add_heuristic<LiftedTask>(m, "AddRPGHeuristic");
     bind_rpg_ff_heuristic<LiftedTask>(m, "FFRPGHeuristic");
     bind_goal_count_heuristic<LiftedTask>(m, "GoalCountHeuristic");
+    bind_cached_heuristic<LiftedTask>(m, "CachedHeuristic");
 }
 
 namespace astar_eager
@@ -127,6 +144,7 @@ void bind_ground_module_definitions(nb::module_& m)
     bind_find_solution<GroundTask>(m, "find_solution");
     bind_event_handler<GroundTask>(m, "EventHandler");
     bind_default_event_handler<GroundTask>(m, "DefaultEventHandler");
+    bind_json_lines_event_handler<GroundTask>(m, "JsonLinesEventHandler");
 }
 
 void bind_lifted_module_definitions(nb::module_& m)
@@ -135,6 +153,7 @@ void bind_lifted_module_definitions(nb::module_& m)
     bind_find_solution<LiftedTask>(m, "find_solution");
     bind_event_handler<LiftedTask>(m, "EventHandler");
     bind_default_event_handler<LiftedTask>(m, "DefaultEventHandler");
+    bind_json_lines_event_handler<LiftedTask>(m, "JsonLinesEventHandler");
 }
 }
 
@@ -146,6 +165,7 @@ void bind_ground_module_definitions(nb::module_& m)
     bind_find_solution<GroundTask>(m, "find_solution");
     bind_event_handler<GroundTask>(m, "EventHandler");
     bind_default_event_handler<GroundTask>(m, "DefaultEventHandler");
+    bind_json_lines_event_handler<GroundTask>(m, "JsonLinesEventHandler");
 }
 
 void bind_lifted_module_definitions(nb::module_& m)
@@ -154,6 +174,7 @@ void bind_lifted_module_definitions(nb::module_& m)
     bind_find_solution<LiftedTask>(m, "find_solution");
     bind_event_handler<LiftedTask>(m, "EventHandler");
     bind_default_event_handler<LiftedTask>(m, "DefaultEventHandler");
+    bind_json_lines_event_handler<LiftedTask>(m, "JsonLinesEventHandler");
 }
 }
 
@@ -145,10 +145,11 @@ void bind_state_repository(nb::module_& m, const std::string& name)
     using T = StateRepository<Task>;
 
     nb::class_<T>(m, name.c_str())  //
-        .def(nb::new_([](std::shared_ptr<Task> task, std::shared_ptr<ExecutionContext> execution_context)
-                      { return T::create(std::move(task), std::move(execution_context)); }),
+        .def(nb::new_([](std::shared_ptr<Task> task, std::shared_ptr<ExecutionContext> execution_context, StateStoragePolicy storage_policy)
+                      { return T::create(std::move(task), std::move(execution_context), storage_policy); }),
              "task"_a,
-             "execution_context"_a)
+             "execution_context"_a,
+             "storage_policy"_a = StateStoragePolicy::TREE_COMPRESSION)
         .def("get_initial_state", &T::get_initial_state, nb::rv_policy::move)
         .def("get_registered_state", &T::get_registered_state, nb::rv_policy::move, "state_index"_a)
         .def("create_state",
@@ -157,7 +158,9 @@ void bind_state_repository(nb::module_& m, const std::string& name)
              nb::rv_policy::move,
              "fluent_fact"_a,
              "fterm_values"_a)
-        .def("get_axiom_evaluator", &T::get_axiom_evaluator, nb::rv_policy::copy);
+        .def("get_axiom_evaluator", &T::get_axiom_evaluator, nb::rv_policy::copy)
+        .def("get_storage_policy", &T::get_storage_policy)
+        .def("memory_usage", &T::memory_usage);
 }
 
 template<typename Task>
@@ -166,19 +169,32 @@ void bind_successor_generator(nb::module_& m, const std::string& name)
     using T = SuccessorGenerator<Task>;
 
     nb::class_<T>(m, name.c_str())
-        .def(nb::new_([](std::shared_ptr<Task> task, std::shared_ptr<ExecutionContext> execution_context)
-                      { return T::create(std::move(task), std::move(execution_context)); }),
+        .def(nb::new_([](std::shared_ptr<Task> task, std::shared_ptr<ExecutionContext> execution_context, StateStoragePolicy storage_policy)
+                      { return T::create(std::move(task), std::move(execution_context), storage_policy); }),
              "task"_a,
-             "execution_context"_a)
+             "execution_context"_a,
+             "storage_policy"_a = StateStoragePolicy::TREE_COMPRESSION)
         .def("get_initial_node", &T::get_initial_node, nb::rv_policy::move)
         .def("get_labeled_successor_nodes",
              nb::overload_cast<const Node<Task>&>(&T::get_labeled_successor_nodes),
              nb::rv_policy::move,
              "node"_a,
              nb::call_guard<nb::gil_scoped_release>())
+        .def(
+            "get_applicable_actions",
+            [](T& self, const Node<Task>& node)
+            {
+                auto result = formalism::planning::GroundActionViewList {};
+                self.get_applicable_actions(node, result);
+                return result;
+            },
+            nb::rv_policy::move,
+            "node"_a,
+            nb::call_guard<nb::gil_scoped_release>())
         .def("get_successor_node", &T::get_successor_node, "node"_a, "action"_a)
         .def("get_node", &T::get_node, nb::rv_policy::move, "state_index"_a)
-        .def("get_state_repository", &T::get_state_repository, nb::rv_policy::copy);
+        .def("get_state_repository", &T::get_state_repository, nb::rv_policy::copy)
+        .def("memory_usage", &T::memory_usage);
 }
 
 template<typename Task>
@@ -186,7 +202,13 @@ void bind_search_result(nb::module_& m, const std::string& name)
 {
     using T = SearchResult<Task>;
 
-    nb::class_<T>(m, name.c_str()).def(nb::init<>()).def_rw("status", &T::status).def_rw("plan", &T::plan).def_rw("goal_node", &T::goal_node);
+    nb::class_<T>(m, name.c_str())
+        .def(nb::init<>())
+        .def_rw("status", &T::status)
+        .def_rw("plan", &T::plan)
+        .def_rw("goal_node", &T::goal_node)
+        .def_rw("search_nodes_memory_usage", &T::search_nodes_memory_usage)
+        .def_rw("openlist_memory_usage", &T::openlist_memory_usage);
 }
 
 template<typename Task>
@@ -251,7 +273,19 @@ void bind_pruning_strategy(nb::module_& m, const std::string& name)
              nb::overload_cast<const StateView<Task>&, const StateView<Task>&, bool>(&T::should_prune_successor_state),
              "state"_a,
              "succ_state"_a,
-             "is_new_succ_state"_a);
+             "is_new_succ_state"_a)
+        .def("preserves_optimality", &T::preserves_optimality)
+        .def("memory_usage", &T::memory_usage);
+}
+
+template<typename Task>
+void bind_symmetry_pruning_strategy(nb::module_& m, const std::string& name)
+{
+    using T = SymmetryPruningStrategy<Task>;
+
+    nb::class_<T, PruningStrategy<Task>>(m, name.c_str())  //
+        .def(nb::init<const Task&>(), "task"_a)
+        .def("get_num_symmetry_generators", [](const T& self) { return self.get_symmetries().get_num_generators(); });
 }
 
 template<typename Task>
@@ -278,7 +312,8 @@ void bind_heuristic(nb::module_& m, const std::string& name)
     nb::class_<T, PyHeuristic<Task>>(m, name.c_str())  //
         .def("set_goal", &T::set_goal, "goal"_a)
         .def("evaluate", &T::evaluate, "state"_a, nb::call_guard<nb::gil_scoped_release>())
-        .def("get_preferred_actions", &T::get_preferred_action_views);
+        .def("get_preferred_actions", &T::get_preferred_action_views)
+        .def("memory_usage", &T::memory_usage);
 }
 
 template<typename Task>
@@ -299,16 +334,33 @@ void bind_goal_count_heuristic(nb::module_& m, const std::string& name)
         .def(nb::new_([](std::shared_ptr<const Task> task) { return T::create(std::move(task)); }));
 }
 
+template<typename Task>
+void bind_cached_heuristic(nb::module_& m, const std::string& name)
+{
+    using T = CachedHeuristic<Task>;
+
+    nb::class_<T, Heuristic<Task>>(m, name.c_str())  //
+        .def(nb::new_([](std::shared_ptr<const Task> task, HeuristicPtr<Task> heuristic) { return T::create(std::move(task), std::move(heuristic)); }),
+             "task"_a,
+             "heuristic"_a)
+        .def("clear", &T::clear)
+        .def("get_num_hits", &T::get_num_hits)
+        .def("get_num_misses", &T::get_num_misses)
+        .def("get_hit_rate", &T::get_hit_rate)
+        .def("memory_usage", &T::memory_usage);
+}
+
 template<typename Task>
 void bind_rpg_max_heuristic(nb::module_& m, const std::string& name)
 {
     using T = MaxRPGHeuristic<Task>;
 
     nb::class_<T, Heuristic<Task>>(m, name.c_str())  //
-        .def(nb::new_([](std::shared_ptr<Task> task, std::shared_ptr<ExecutionContext> execution_context)
-                      { return T::create(std::move(task), std::move(execution_context)); }),
+        .def(nb::new_([](std::shared_ptr<Task> task, std::shared_ptr<ExecutionContext> execution_context, bool use_action_costs)
+                      { return T::create(std::move(task), std::move(execution_context), use_action_costs); }),
              "task"_a,
-             "execution_context"_a);
+             "execution_context"_a,
+             "use_action_costs"_a = false);
 }
 
 template<typename Task>
@@ -317,10 +369,11 @@ void bind_rpg_add_heuristic(nb::module_& m, const std::string& name)
     using T = AddRPGHeuristic<Task>;
 
     nb::class_<T, Heuristic<Task>>(m, name.c_str())  //
-        .def(nb::new_([](std::shared_ptr<Task> task, std::shared_ptr<ExecutionContext> execution_context)
-                      { return T::create(std::move(task), std::move(execution_context)); }),
+        .def(nb::new_([](std::shared_ptr<Task> task, std::shared_ptr<ExecutionContext> execution_context, bool use_action_costs)
+                      { return T::create(std::move(task), std::move(execution_context), use_action_costs); }),
              "task"_a,
-             "execution_context"_a);
+             "execution_context"_a,
+             "use_action_costs"_a = false);
 }
 
 template<typename Task>
@@ -329,10 +382,11 @@ void bind_rpg_ff_heuristic(nb::module_& m, const std::string& name)
     using T = FFRPGHeuristic<Task>;
 
     nb::class_<T, Heuristic<Task>>(m, name.c_str())  //
-        .def(nb::new_([](std::shared_ptr<Task> task, std::shared_ptr<ExecutionContext> execution_context)
-                      { return T::create(std::move(task), std::move(execution_context)); }),
+        .def(nb::new_([](std::shared_ptr<Task> task, std::shared_ptr<ExecutionContext> execution_context, bool use_action_costs)
+                      { return T::create(std::move(task), std::move(execution_context), use_action_costs); }),
              "task"_a,
-             "execution_context"_a);
+             "execution_context"_a,
+             "use_action_costs"_a = false);
 }
 
 namespace astar_eager
@@ -390,6 +444,8 @@ void bind_options(nb::module_& m, const std::string& name)
         .def_rw("goal_strategy", &T::goal_strategy)
         .def_rw("max_num_states", &T::max_num_states)
         .def_rw("max_time", &T::max_time)
+        .def_rw("max_memory_bytes", &T::max_memory_bytes)
+        .def_rw("memory_check_interval", &T::memory_check_interval)
         .def_rw("random_seed", &T::random_seed)
         .def_rw("shuffle_labeled_succ_nodes", &T::shuffle_labeled_succ_nodes);
 }
@@ -438,6 +494,20 @@ void bind_default_event_handler(nb::module_& m, const std::string& name)
         .def(nb::init<size_t>(), "verbosity"_a)
         .def("get_statistics", &T::get_statistics);
 }
+
+template<typename Task>
+void bind_json_lines_event_handler(nb::module_& m, const std::string& name)
+{
+    using T = JsonLinesEventHandler<Task>;
+
+    nb::class_<T, EventHandler<Task>>(m, name.c_str())  //
+        .def(nb::new_([](int fd, size_t interval_ms, EventHandlerPtr<Task> inner)
+                      { return T::create(fd, std::chrono::milliseconds(interval_ms), ProgressProbe {}, std::move(inner)); }),
+             "fd"_a,
+             "interval_ms"_a = 1000,
+             "inner"_a = nullptr)
+        .def("get_statistics", &T::get_statistics);
+}
 }
 
 namespace gbfs_lazy
@@ -485,6 +555,8 @@ void bind_options(nb::module_& m, const std::string& name)
         .def_rw("goal_strategy", &T::goal_strategy)
         .def_rw("max_num_states", &T::max_num_states)
         .def_rw("max_time", &T::max_time)
+        .def_rw("max_memory_bytes", &T::max_memory_bytes)
+        .def_rw("memory_check_interval", &T::memory_check_interval)
         .def_rw("boost_preferred_queue", &T::boost_preferred_queue)
         .def_rw("random_seed", &T::random_seed)
         .def_rw("shuffle_labeled_succ_nodes", &T::shuffle_labeled_succ_nodes);
@@ -531,6 +603,20 @@ void bind_default_event_handler(nb::module_& m, const std::string& name)
         .def(nb::init<size_t>(), "verbosity"_a)
         .def("get_statistics", &T::get_statistics);
 }
+
+template<typename Task>
+void bind_json_lines_event_handler(nb::module_& m, const std::string& name)
+{
+    using T = JsonLinesEventHandler<Task>;
+
+    nb::class_<T, EventHandler<Task>>(m, name.c_str())  //
+        .def(nb::new_([](int fd, size_t interval_ms, EventHandlerPtr<Task> inner)
+                      { return T::create(fd, std::chrono::milliseconds(interval_ms), ProgressProbe {}, std::move(inner)); }),
+             "fd"_a,
+             "interval_ms"_a = 1000,
+             "inner"_a = nullptr)
+        .def("get_statistics", &T::get_statistics);
+}
 }
 
 }
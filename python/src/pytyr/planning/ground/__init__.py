@@ -14,6 +14,7 @@ from pytyr.pytyr.planning.ground import (
     GoalStrategy,
     TaskGoalStrategy,
     PruningStrategy,
+    SymmetryPruningStrategy,
     Heuristic,
     BlindHeuristic,
     GoalCountHeuristic,
@@ -5,4 +5,5 @@ from pytyr.pytyr.planning.ground.astar_eager import (
     find_solution,
     EventHandler,
     DefaultEventHandler,
+    JsonLinesEventHandler,
 )
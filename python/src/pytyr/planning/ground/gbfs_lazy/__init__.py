@@ -5,4 +5,5 @@ from pytyr.pytyr.planning.ground.gbfs_lazy import (
     find_solution,
     EventHandler,
     DefaultEventHandler,
+    JsonLinesEventHandler,
 )
@@ -14,6 +14,7 @@ from pytyr.pytyr.planning.lifted import (
     GoalStrategy,
     TaskGoalStrategy,
     PruningStrategy,
+    SymmetryPruningStrategy,
     Heuristic,
     BlindHeuristic,
     MaxRPGHeuristic,
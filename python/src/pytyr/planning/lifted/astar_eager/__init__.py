@@ -5,5 +5,6 @@ from pytyr.pytyr.planning.lifted.astar_eager import (
     find_solution,
     EventHandler,
     DefaultEventHandler,
+    JsonLinesEventHandler,
 )
 
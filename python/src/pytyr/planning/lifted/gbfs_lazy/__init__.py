@@ -5,5 +5,6 @@ from pytyr.pytyr.planning.lifted.gbfs_lazy import (
     find_solution,
     EventHandler,
     DefaultEventHandler,
+    JsonLinesEventHandler,
 )
 
@@ -39,21 +39,27 @@ namespace fd = tyr::formalism::datalog;
 namespace tyr::analysis
 {
 
+static ListenerStratum compute_listeners(const RuleStratum& stratum, const fd::Repository& context)
+{
+    auto listeners = ListenerStratum {};
+
+    for (const auto rule : stratum)
+        for (const auto literal : make_view(rule, context).get_body().get_literals<f::FluentTag>())
+            if (literal.get_polarity())
+                listeners[literal.get_atom().get_predicate().get_index()].insert(rule);
+
+    return listeners;
+}
+
 ListenerStrata compute_listeners(const RuleStrata& strata, const fd::Repository& context)
 {
     auto listeners = ListenerStrata();
 
     for (const auto& stratum : strata.data)
-    {
-        auto listeners_in_stratum = ListenerStratum {};
-
-        for (const auto rule : stratum)
-            for (const auto literal : make_view(rule, context).get_body().get_literals<f::FluentTag>())
-                if (literal.get_polarity())
-                    listeners_in_stratum[literal.get_atom().get_predicate().get_index()].insert(rule);
+        listeners.data.push_back(compute_listeners(stratum, context));
 
-        listeners.data.push_back(std::move(listeners_in_stratum));
-    }
+    for (const auto& component : strata.components)
+        listeners.components.push_back(compute_listeners(component, context));
 
     // std::cout << listeners.data << std::endl;
 
@@ -78,10 +78,57 @@ RuleStrata compute_rule_stratification(fd::ProgramView program)
     for (const auto rule : program.get_rules())
         buckets[predicate_stratum[uint_t(rule.get_head().get_predicate().get_index())]].push_back(rule.get_index());
 
+    // 7) Number the components with rules in topological order
+    const auto topo = stratification::compute_topological_order(dag);
+
+    auto is_derived = std::vector<bool>(num_predicates, false);
+    auto has_rules = std::vector<bool>(num_comps, false);
+    for (const auto rule : program.get_rules())
+    {
+        const auto h_predicate = uint_t(rule.get_head().get_predicate().get_index());
+        is_derived[h_predicate] = true;
+        has_rules[comp[h_predicate]] = true;
+    }
+
+    auto comp_unit = std::vector<uint_t>(num_comps, std::numeric_limits<uint_t>::max());
+    auto num_units = uint_t(0);
+    for (const auto c : topo)
+        if (has_rules[c])
+            comp_unit[c] = num_units++;
+
+    // 8) Bucket rules by head component and collect the lower components whose derived predicates occur in their rule bodies
+    auto components = std::vector<IndexList<fd::Rule>>(num_units);
+    auto dependencies = std::vector<std::vector<uint_t>>(num_units);
+    for (const auto rule : program.get_rules())
+    {
+        const auto h_comp = comp[uint_t(rule.get_head().get_predicate().get_index())];
+        const auto h_unit = comp_unit[h_comp];
+
+        components[h_unit].push_back(rule.get_index());
+
+        for (const auto literal : rule.get_body().get_literals<f::FluentTag>())
+        {
+            const auto b_predicate = uint_t(literal.get_atom().get_predicate().get_index());
+
+            if (is_derived[b_predicate] && comp[b_predicate] != h_comp)
+                dependencies[h_unit].push_back(comp_unit[comp[b_predicate]]);
+        }
+    }
+
+    for (auto& d : dependencies)
+    {
+        std::sort(d.begin(), d.end());
+        d.erase(std::unique(d.begin(), d.end()), d.end());
+    }
+
     auto out = RuleStrata {};
     out.data.reserve(buckets.size());
     for (auto& b : buckets)
         out.data.emplace_back(RuleStratum(std::move(b)));
+    out.components.reserve(components.size());
+    for (auto& c : components)
+        out.components.emplace_back(RuleStratum(std::move(c)));
+    out.dependencies = std::move(dependencies);
 
     return out;
 }
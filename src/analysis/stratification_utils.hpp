@@ -116,8 +116,8 @@ inline Dag build_condensation_dag(const DepGraph& g, const std::vector<uint_t>&
     return dag;
 }
 
-// Compute minimal strata on SCC DAG: s[dst] = max(s[dst], s[src] + inc)
-inline std::vector<uint_t> compute_component_strata(const Dag& dag)
+// Compute the components of the SCC DAG in topological order
+inline std::vector<DagV> compute_topological_order(const Dag& dag)
 {
     auto topo = std::vector<DagV> {};
     topo.reserve(boost::num_vertices(dag));
@@ -125,6 +125,14 @@ inline std::vector<uint_t> compute_component_strata(const Dag& dag)
 
     std::reverse(topo.begin(), topo.end());
 
+    return topo;
+}
+
+// Compute minimal strata on SCC DAG: s[dst] = max(s[dst], s[src] + inc)
+inline std::vector<uint_t> compute_component_strata(const Dag& dag)
+{
+    const auto topo = compute_topological_order(dag);
+
     auto s = std::vector<uint_t>(boost::num_vertices(dag), 0);
 
     for (const auto u : topo)
@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) 2025 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "tyr/common/perf_counters.hpp"
+
+#if defined(TYR_ENABLE_PERF_COUNTERS) && defined(__linux__)
+#define TYR_PERF_COUNTERS_AVAILABLE
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace tyr
+{
+
+#ifdef TYR_PERF_COUNTERS_AVAILABLE
+
+static int open_counter(uint32_t type, uint64_t config)
+{
+    auto attr = perf_event_attr {};
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = type;
+    attr.config = config;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+
+    // Count the calling thread on any CPU.
+    return static_cast<int>(::syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+}
+
+PerfCounterGroup::PerfCounterGroup() :
+    m_fds { open_counter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES),
+            open_counter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS),
+            open_counter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES),
+            open_counter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES) },
+    m_available(false)
+{
+    for (const auto fd : m_fds)
+        m_available |= (fd != -1);
+}
+
+PerfCounterGroup::~PerfCounterGroup()
+{
+    for (const auto fd : m_fds)
+        if (fd != -1)
+            ::close(fd);
+}
+
+static uint64_t read_counter(int fd) noexcept
+{
+    uint64_t value = 0;
+    if (fd == -1 || ::read(fd, &value, sizeof(value)) != sizeof(value))
+        return 0;
+    return value;
+}
+
+PerfCounters PerfCounterGroup::read() const noexcept
+{
+    return PerfCounters { read_counter(m_fds[0]), read_counter(m_fds[1]), read_counter(m_fds[2]), read_counter(m_fds[3]) };
+}
+
+#else
+
+PerfCounterGroup::PerfCounterGroup() : m_fds { -1, -1, -1, -1 }, m_available(false) {}
+
+PerfCounterGroup::~PerfCounterGroup() = default;
+
+PerfCounters PerfCounterGroup::read() const noexcept { return PerfCounters {}; }
+
+#endif
+
+PerfCounterGroup& PerfCounterGroup::get_thread_instance()
+{
+    thread_local auto group = PerfCounterGroup();
+    return group;
+}
+
+}
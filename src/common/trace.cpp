@@ -0,0 +1,128 @@
+/*
+ * Copyright (C) 2025 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "tyr/common/trace.hpp"
+
+#include <fstream>
+#include <iomanip>
+#include <stdexcept>
+
+namespace tyr::trace
+{
+
+Tracer& Tracer::instance()
+{
+    static auto tracer = Tracer();
+    return tracer;
+}
+
+Tracer::Tracer() : m_enabled(false), m_origin(std::chrono::steady_clock::now()), m_mutex(), m_capacity(size_t(1) << 16), m_buffers() {}
+
+void Tracer::enable(size_t capacity)
+{
+    if (capacity == 0)
+        throw std::invalid_argument("Tracer::enable(...): Capacity must be positive.");
+
+    {
+        auto lock = std::lock_guard(m_mutex);
+        m_capacity = capacity;
+    }
+
+    m_enabled.store(true, std::memory_order_relaxed);
+}
+
+void Tracer::clear()
+{
+    auto lock = std::lock_guard(m_mutex);
+
+    for (auto& buffer : m_buffers)
+        buffer->clear();
+}
+
+ThreadBuffer& Tracer::get_thread_buffer()
+{
+    // Buffers are never destroyed, so the cached pointer remains valid for the lifetime of the thread.
+    thread_local ThreadBuffer* t_buffer = nullptr;
+
+    if (!t_buffer)
+    {
+        auto lock = std::lock_guard(m_mutex);
+        t_buffer = m_buffers.emplace_back(std::make_unique<ThreadBuffer>(static_cast<uint32_t>(m_buffers.size()), m_capacity)).get();
+    }
+
+    return *t_buffer;
+}
+
+void Tracer::record(const Event& event) { get_thread_buffer().push_back(event); }
+
+void Tracer::write_chrome_trace(std::ostream& out) const
+{
+    auto lock = std::lock_guard(m_mutex);
+
+    out << std::fixed << std::setprecision(3);
+    out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+
+    bool first = true;
+    const auto separator = [&]() -> std::ostream&
+    {
+        if (!first)
+            out << ",";
+        first = false;
+        return out << "\n";
+    };
+
+    for (const auto& buffer : m_buffers)
+    {
+        const auto tid = buffer->get_thread_id();
+
+        separator() << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << tid << ",\"args\":{\"name\":\"thread " << tid << "\"}}";
+
+        buffer->for_each(
+            [&](const Event& event)
+            {
+                // Chrome trace timestamps are in microseconds.
+                separator() << "{\"name\":\"" << event.name << "\",\"cat\":\"" << event.category << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << tid
+                            << ",\"ts\":" << event.begin_ns / 1000.0 << ",\"dur\":" << (event.end_ns - event.begin_ns) / 1000.0;
+                if (event.arg >= 0)
+                    out << ",\"args\":{\"index\":" << event.arg << "}";
+                out << "}";
+            });
+    }
+
+    out << "\n]}\n";
+}
+
+void Tracer::write_chrome_trace(const std::filesystem::path& filepath) const
+{
+    auto out = std::ofstream(filepath);
+    if (!out.is_open())
+        throw std::runtime_error("Tracer::write_chrome_trace(...): Failed to open " + filepath.string() + ".");
+
+    write_chrome_trace(out);
+}
+
+size_t Tracer::get_num_events() const
+{
+    auto lock = std::lock_guard(m_mutex);
+
+    size_t num_events = 0;
+    for (const auto& buffer : m_buffers)
+        num_events += buffer->size();
+    return num_events;
+}
+
+}
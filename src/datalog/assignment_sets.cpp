@@ -131,6 +131,11 @@ template size_t PerfectAssignmentHash::get_rank<false>(const EdgeAssignment& ass
 
 size_t PerfectAssignmentHash::size() const noexcept { return m_num_assignments * m_num_assignments; }
 
+size_t PerfectAssignmentHash::memory_usage() const noexcept
+{
+    return get_memory_usage(m_remapping) + get_memory_usage(m_offsets) + get_memory_usage(m_parameter_domains);
+}
+
 /**
  * PredicateAssignmentSet
  */
@@ -152,6 +157,12 @@ void PredicateAssignmentSet<T>::reset() noexcept
     m_set.reset();
 }
 
+template<formalism::FactKind T>
+size_t PredicateAssignmentSet<T>::memory_usage() const noexcept
+{
+    return m_hash.memory_usage() + get_memory_usage(m_set);
+}
+
 template<formalism::FactKind T>
 void PredicateAssignmentSet<T>::insert(formalism::datalog::PredicateBindingView<T> binding)
 {
@@ -258,6 +269,15 @@ void PredicateAssignmentSets<T>::reset() noexcept
         set.reset();
 }
 
+template<formalism::FactKind T>
+size_t PredicateAssignmentSets<T>::memory_usage() const noexcept
+{
+    auto bytes = m_sets.capacity() * sizeof(PredicateAssignmentSet<T>);
+    for (const auto& set : m_sets)
+        bytes += set.memory_usage();
+    return bytes;
+}
+
 template<formalism::FactKind T>
 void PredicateAssignmentSets<T>::insert(formalism::datalog::GroundAtomView<T> ground_atom)
 {
@@ -318,6 +338,12 @@ void FunctionAssignmentSet<T>::reset() noexcept
     std::fill(m_set.begin(), m_set.end(), ClosedInterval<float_t>());
 }
 
+template<formalism::FactKind T>
+size_t FunctionAssignmentSet<T>::memory_usage() const noexcept
+{
+    return m_hash.memory_usage() + get_memory_usage(m_set);
+}
+
 template<formalism::FactKind T>
 void FunctionAssignmentSet<T>::insert(formalism::datalog::FunctionBindingView<T> binding, float_t value)
 {
@@ -437,6 +463,15 @@ void FunctionAssignmentSets<T>::reset() noexcept
         set.reset();
 }
 
+template<formalism::FactKind T>
+size_t FunctionAssignmentSets<T>::memory_usage() const noexcept
+{
+    auto bytes = m_sets.capacity() * sizeof(FunctionAssignmentSet<T>);
+    for (const auto& set : m_sets)
+        bytes += set.memory_usage();
+    return bytes;
+}
+
 template<formalism::FactKind T>
 void FunctionAssignmentSets<T>::insert(formalism::datalog::GroundFunctionTermView<T> function_term, float_t value)
 {
@@ -550,6 +585,12 @@ void TaggedAssignmentSets<T>::reset() noexcept
     function.reset();
 }
 
+template<formalism::FactKind T>
+size_t TaggedAssignmentSets<T>::memory_usage() const noexcept
+{
+    return predicate.memory_usage() + function.memory_usage();
+}
+
 template class TaggedAssignmentSets<f::StaticTag>;
 template class TaggedAssignmentSets<f::FluentTag>;
 
@@ -23,6 +23,8 @@
 #include "tyr/common/equal_to.hpp"     // for EqualTo
 #include "tyr/common/formatter.hpp"
 #include "tyr/common/hash.hpp"                // for Hash
+#include "tyr/common/perf_counters.hpp"       // for PerfCounterScope
+#include "tyr/common/trace.hpp"               // for TraceScope
 #include "tyr/common/types.hpp"               // for View
 #include "tyr/common/vector.hpp"              // for View
 #include "tyr/datalog/applicability.hpp"      // for is_ap...
@@ -46,9 +48,10 @@
 
 #include <algorithm>  // for all_of
 #include <assert.h>   // for assert
+#include <atomic>     // for atomic
 #include <boost/dynamic_bitset.hpp>
 #include <memory>  // for __sha...
-#include <oneapi/tbb/parallel_for_each.h>
+#include <oneapi/tbb/parallel_for.h>
 #include <oneapi/tbb/parallel_invoke.h>
 #include <tuple>    // for opera...
 #include <utility>  // for pair
@@ -325,20 +328,31 @@ void process_pending(RuleExecutionContext<OrAP, AndAP, TP>& rctx)
 }
 
 template<OrAnnotationPolicyConcept OrAP, AndAnnotationPolicyConcept AndAP, TerminationPolicyConcept TP>
-void solve_bottom_up_for_stratum(StratumExecutionContext<OrAP, AndAP, TP>& ctx)
+void solve_bottom_up(ProgramExecutionContext<OrAP, AndAP, TP>& ctx)
 {
-    auto& scheduler = ctx.scheduler;
-    auto& facts = ctx.ctx.ws.facts;
-    auto& cost_buckets = ctx.ctx.ws.cost_buckets;
-    auto& ws = ctx.ctx.ws;
-    auto& tp = ctx.ctx.ws.tp;
+    const auto program_stopwatch = StopwatchScope(ctx.ws.statistics.total_time);
+    const auto program_trace = trace::TraceScope("program", "datalog");
+    const auto program_counters = PerfCounterScope(ctx.ws.statistics.total_counters);
+    ++ctx.ws.statistics.num_executions;
 
-    scheduler.activate_all();
+    auto& schedulers = ctx.ws.schedulers;
+    auto& facts = ctx.ws.facts;
+    auto& cost_buckets = ctx.ws.cost_buckets;
+    auto& ws = ctx.ws;
+    auto& tp = ctx.ws.tp;
+
+    schedulers.start();
 
     cost_buckets.clear();
 
+    // The running strata do not depend on each other, hence, their rules are processed together in each fixpoint iteration.
+    auto stratum_ctxs = std::vector<StratumExecutionContext<OrAP, AndAP, TP>> {};
+    auto active_rule_batches = std::vector<std::pair<size_t, RuleSchedulerStratum::RuleBatch>> {};  ///< Position in stratum_ctxs and batch
+
     while (true)
     {
+        const auto iteration_trace = trace::TraceScope("fixpoint_iteration", "datalog");
+
         // std::cout << "Cost: " << cost_buckets.current_cost() << std::endl;
 
         // Check whether min cost for goal was proven.
@@ -347,6 +361,12 @@ void solve_bottom_up_for_stratum(StratumExecutionContext<OrAP, AndAP, TP>& ctx)
             return;
         }
 
+        // Terminate if all strata are finished.
+        if (schedulers.get_running_strata().empty())
+        {
+            return;
+        }
+
         // std::cout << std::endl;
         // std::cout << "=======================================================================" << std::endl;
         // std::cout << "Facts: " << std::endl;
@@ -363,48 +383,87 @@ void solve_bottom_up_for_stratum(StratumExecutionContext<OrAP, AndAP, TP>& ctx)
         // }
         // std::cout << std::endl;
 
-        scheduler.on_start_iteration();
+        schedulers.on_start_iteration();
+
+        stratum_ctxs.clear();
+        active_rule_batches.clear();
+        for (const auto stratum : schedulers.get_running_strata())
+        {
+            auto& scheduler = schedulers.get_stratum(stratum);
+
+            for (const auto& batch : scheduler.get_active_rule_batches())
+                active_rule_batches.emplace_back(stratum_ctxs.size(), batch);
+
+            stratum_ctxs.push_back(ctx.get_stratum_execution_context(stratum));
+        }
 
-        const auto& active_rules = scheduler.get_active_rules();
+        // Interleave the batches of the running strata by the time estimate of their first, i.e., most expensive, rule.
+        if (stratum_ctxs.size() > 1)
+            std::stable_sort(active_rule_batches.begin(),
+                             active_rule_batches.end(),
+                             [&](auto&& lhs, auto&& rhs)
+                             {
+                                 return stratum_ctxs[lhs.first].scheduler.get_time_estimate(lhs.second.front())
+                                        > stratum_ctxs[rhs.first].scheduler.get_time_estimate(rhs.second.front());
+                             });
 
         /**
          * Parallel process pending applicability checks and generate ground witnesses.
          */
 
         {
-            const auto program_stopwatch = StopwatchScope(ws.statistics.parallel_time);
+            const auto parallel_stopwatch = StopwatchScope(ws.statistics.parallel_time);
 
-            oneapi::tbb::parallel_for_each(active_rules.begin(),
-                                           active_rules.end(),
-                                           [&](auto&& rule_index)
-                                           {
-                                               // std::cout << make_view(rule_index, ws.repository) << std::endl;
+            auto process_rule = [&](auto&& stratum_ctx, auto&& rule_index)
+            {
+                // std::cout << make_view(rule_index, ws.repository) << std::endl;
 
-                                               auto rctx = ctx.get_rule_execution_context(rule_index);
+                auto rctx = stratum_ctx.get_rule_execution_context(rule_index);
 
-                                               const auto total_time = StopwatchScope(rctx.ws_rule.common.statistics.total_time);
-                                               ++rctx.ws_rule.common.statistics.num_executions;
+                const auto rule_trace = trace::TraceScope("rule", "datalog", uint_t(rule_index));
+                const auto total_time = StopwatchScope(rctx.ws_rule.common.statistics.total_time);
+                ++rctx.ws_rule.common.statistics.num_executions;
 
-                                               rctx.clear_iteration();  ///< Clear iteration before process_pending/generate
+                rctx.clear_iteration();  ///< Clear iteration before process_pending/generate
 
-                                               {
-                                                   const auto initialize_time = StopwatchScope(rctx.ws_rule.common.statistics.initialize_time);
+                {
+                    const auto initialize_time = StopwatchScope(rctx.ws_rule.common.statistics.initialize_time);
 
-                                                   rctx.initialize();  ///< Initialize before process_pending/generate
-                                               }
+                    rctx.initialize();  ///< Initialize before process_pending/generate
+                }
 
-                                               {
-                                                   const auto process_pending_time = StopwatchScope(rctx.ws_rule.common.statistics.process_pending_time);
+                {
+                    const auto process_pending_time = StopwatchScope(rctx.ws_rule.common.statistics.process_pending_time);
 
-                                                   process_pending(rctx);
-                                               }
+                    process_pending(rctx);
+                }
 
-                                               {
-                                                   const auto process_generate_time = StopwatchScope(rctx.ws_rule.common.statistics.process_generate_time);
+                {
+                    const auto process_generate_time = StopwatchScope(rctx.ws_rule.common.statistics.process_generate_time);
+                    const auto process_generate_counters = PerfCounterScope(rctx.ws_rule.common.statistics.process_generate_counters);
 
-                                                   generate(rctx);
-                                               }
-                                           });
+                    generate(rctx);
+                }
+            };
+
+            // Workers pull batches in order of decreasing time estimate, i.e., longest processing time first.
+            auto next_batch = std::atomic<size_t>(0);
+            const auto num_workers = std::min(active_rule_batches.size(), static_cast<size_t>(oneapi::tbb::this_task_arena::max_concurrency()));
+
+            oneapi::tbb::parallel_for(
+                size_t(0),
+                num_workers,
+                [&](size_t)
+                {
+                    for (auto b = next_batch.fetch_add(1, std::memory_order_relaxed); b < active_rule_batches.size();
+                         b = next_batch.fetch_add(1, std::memory_order_relaxed))
+                    {
+                        const auto& [i, batch] = active_rule_batches[b];
+                        for (const auto rule_index : batch)
+                            process_rule(stratum_ctxs[i], rule_index);
+                    }
+                },
+                oneapi::tbb::static_partitioner());
         }
 
         // Clear delta facts
@@ -418,45 +477,59 @@ void solve_bottom_up_for_stratum(StratumExecutionContext<OrAP, AndAP, TP>& ctx)
          */
 
         {
-            for (const auto rule_index : active_rules)
+            const auto merge_trace = trace::TraceScope("merge", "datalog");
+            const auto merge_counters = PerfCounterScope(ws.statistics.merge_counters);
+
+            for (auto& stratum_ctx : stratum_ctxs)
             {
-                const auto i = uint_t(rule_index);
-                auto merge_context = fd::MergeContext { ws.datalog_builder, ws.workspace_repository };
-                const auto& ws_rule = ws.rules[i];
+                auto& scheduler = stratum_ctx.scheduler;
 
-                for (const auto& worker : ws_rule->worker)
+                for (const auto rule_index : scheduler.get_active_rules())
                 {
-                    for (const auto worker_head_index : worker.iteration.head_rows)
+                    const auto i = uint_t(rule_index);
+                    auto merge_context = fd::MergeContext { ws.datalog_builder, ws.workspace_repository };
+                    const auto& ws_rule = ws.rules[i];
+
+                    scheduler.update_time_estimate(rule_index, ws_rule->common.statistics.total_time);
+
+                    for (const auto& worker : ws_rule->worker)
                     {
-                        const auto worker_head =
-                            make_view(Index<f::RelationBinding<f::Predicate<f::FluentTag>>> { worker.iteration.head_predicate, worker_head_index },
-                                      worker.solve.program_overlay_repository);
+                        for (const auto worker_head_index : worker.iteration.head_rows)
+                        {
+                            const auto worker_head =
+                                make_view(Index<f::RelationBinding<f::Predicate<f::FluentTag>>> { worker.iteration.head_predicate, worker_head_index },
+                                          worker.solve.program_overlay_repository);
 
-                        // Merge head from delta into the program
-                        const auto program_head = fd::merge_d2d(worker_head, merge_context).first;
+                            // Merge head from delta into the program
+                            const auto program_head = fd::merge_d2d(worker_head, merge_context).first;
 
-                        // Update annotation
-                        const auto cost_update = ctx.ctx.ws.or_ap.update_annotation(program_head,
-                                                                                    worker_head,
-                                                                                    ctx.ctx.ws.or_annot,
-                                                                                    worker.iteration.and_annot,
-                                                                                    ctx.ctx.ws.and_annot);
+                            // Update annotation
+                            const auto cost_update =
+                                ws.or_ap.update_annotation(program_head, worker_head, ws.or_annot, worker.iteration.and_annot, ws.and_annot);
 
-                        cost_buckets.update(cost_update, program_head);
+                            cost_buckets.update(cost_update, program_head);
+                        }
                     }
                 }
             }
 
             if (!cost_buckets.advance_to_next_nonempty())
-                return;  // Terminate if no-nonempty bucket was found.
+            {
+                // No running stratum can derive new heads, and the next strata enumerate their costs from zero.
+                schedulers.finish_all();
+
+                cost_buckets.clear();
+
+                continue;
+            }
 
             // Insert next bucket heads into fact and assignment sets + trigger scheduler.
             for (const auto head : cost_buckets.get_current_bucket())
             {
                 if (!facts.fact_sets.predicate.contains(head))
                 {
-                    // Notify scheduler
-                    scheduler.on_generate(head.get_index().relation);
+                    // Notify schedulers
+                    schedulers.on_generate(head.get_index().relation);
 
                     // Notify termination policy
                     tp.achieve(head);
@@ -469,19 +542,11 @@ void solve_bottom_up_for_stratum(StratumExecutionContext<OrAP, AndAP, TP>& ctx)
             }
         }
 
-        scheduler.on_finish_iteration();
-    }
-}
-
-template<OrAnnotationPolicyConcept OrAP, AndAnnotationPolicyConcept AndAP, TerminationPolicyConcept TP>
-void solve_bottom_up(ProgramExecutionContext<OrAP, AndAP, TP>& ctx)
-{
-    const auto program_stopwatch = StopwatchScope(ctx.ws.statistics.total_time);
-    ++ctx.ws.statistics.num_executions;
+        schedulers.on_finish_iteration();
 
-    for (auto stratum_ctx : ctx.get_stratum_execution_contexts())
-    {
-        solve_bottom_up_for_stratum(stratum_ctx);
+        // Without costs, a stratum without active rules cannot derive new heads, and hence, its dependents can start.
+        if (schedulers.is_concurrent())
+            schedulers.finish_idle();
     }
 }
 
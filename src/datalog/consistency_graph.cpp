@@ -36,6 +36,8 @@
 #include "tyr/formalism/datalog/views.hpp"
 
 #include <boost/dynamic_bitset/dynamic_bitset.hpp>
+#include <oneapi/tbb/parallel_for.h>
+#include <oneapi/tbb/parallel_for_each.h>
 #include <optional>
 #include <ranges>
 #include <sstream>
@@ -687,30 +689,45 @@ StaticConsistencyGraph::compute_vertices(const details::TaggedRuleToLiteralInfos
                                          uint_t end_parameter_index,
                                          const TaggedAssignmentSets<f::StaticTag>& static_assignment_sets)
 {
+    const auto num_parameters = end_parameter_index - begin_parameter_index;
+
+    // Test the objects of each parameter in parallel, then number the consistent ones consecutively.
+    auto consistent_objects_per_parameter = std::vector<std::vector<uint_t>>(num_parameters);
+
+    oneapi::tbb::parallel_for(uint_t(0),
+                              num_parameters,
+                              [&](uint_t i)
+                              {
+                                  const auto parameter_index = begin_parameter_index + i;
+
+                                  for (const auto object_index : parameter_domains[parameter_index])
+                                  {
+                                      const auto vertex = details::Vertex(f::ParameterIndex(parameter_index), Index<f::Object>(object_index));
+
+                                      if (consistent_literals(vertex, indexed_literals, static_assignment_sets.predicate))
+                                          consistent_objects_per_parameter[i].push_back(uint_t(object_index));
+                                  }
+                              });
+
     auto vertices = details::Vertices {};
 
     auto vertex_partitions = std::vector<std::vector<uint_t>> {};
     auto object_to_vertex_per_partition = std::vector<std::vector<uint_t>> {};
 
-    for (uint_t parameter_index = begin_parameter_index; parameter_index < end_parameter_index; ++parameter_index)
+    for (uint_t i = 0; i < num_parameters; ++i)
     {
-        auto& parameter_domain = parameter_domains[parameter_index];
+        const auto parameter_index = begin_parameter_index + i;
 
         auto vertex_partition = std::vector<uint_t> {};
         auto object_to_vertex_partition = std::vector<uint_t>(num_objects, std::numeric_limits<uint_t>::max());
 
-        for (const auto object_index : parameter_domain)
+        for (const auto object_index : consistent_objects_per_parameter[i])
         {
             const auto vertex_index = static_cast<uint_t>(vertices.size());
 
-            auto vertex = details::Vertex(f::ParameterIndex(parameter_index), Index<f::Object>(object_index));
-
-            if (consistent_literals(vertex, indexed_literals, static_assignment_sets.predicate))
-            {
-                vertices.push_back(std::move(vertex));
-                vertex_partition.push_back(vertex_index);
-                object_to_vertex_partition[uint_t(object_index)] = vertex_index;
-            }
+            vertices.push_back(details::Vertex(f::ParameterIndex(parameter_index), Index<f::Object>(object_index)));
+            vertex_partition.push_back(vertex_index);
+            object_to_vertex_partition[object_index] = vertex_index;
         }
 
         vertex_partitions.push_back(std::move(vertex_partition));
@@ -727,46 +744,70 @@ kpkc::DeduplicatedAdjacencyMatrix StaticConsistencyGraph::compute_edges(const de
 {
     const auto k = vertex_partitions.size();
 
-    auto matrix = kpkc::AdjacencyMatrix(m_layout);
-
-    auto offset_i = 0;
+    auto offsets = std::vector<uint_t>(k + 1, 0);
+    for (uint_t p = 0; p < k; ++p)
+        offsets[p + 1] = offsets[p] + vertex_partitions[p].size();
 
+    auto partition_pairs = std::vector<std::pair<uint_t, uint_t>> {};
     for (uint_t pi = 0; pi < k; ++pi)
-    {
-        const auto pi_size = vertex_partitions[pi].size();
+        for (uint_t pj = pi + 1; pj < k; ++pj)
+            partition_pairs.emplace_back(pi, pj);
 
-        for (uint_t bi = 0; bi < pi_size; ++bi)
-        {
-            const auto vi = offset_i + bi;
-            const auto& vertex_i = get_vertex(vi);
-            auto offset_j = offset_i + pi_size;
+    const auto num_blocks = m_layout.info.num_blocks;
 
-            for (uint_t pj = pi + 1; pj < k; ++pj)
+    return kpkc::DeduplicatedAdjacencyMatrix(
+        m_layout,
+        [&](uint_t first, uint_t last, std::span<uint64_t> rows)
+        {
+            const auto get_bitset = [&](uint_t v, uint_t p)
             {
-                const auto pj_size = vertex_partitions[pj].size();
-
-                for (uint_t bj = 0; bj < pj_size; ++bj)
-                {
-                    const auto vj = offset_j + bj;
-                    const auto& vertex_j = get_vertex(vj);
-
-                    const auto edge = details::Edge(vertex_i, vertex_j);
-
-                    if (consistent_literals(edge, indexed_literals, static_assignment_sets.predicate))
-                    {
-                        matrix.get_bitset(vi, pj).set(bj);
-                        matrix.get_bitset(vj, pi).set(bi);
-                    }
-                }
-
-                offset_j += pj_size;
-            }
-        }
-
-        offset_i += pi_size;
-    }
-
-    return kpkc::DeduplicatedAdjacencyMatrix(matrix);
+                const auto& info = m_layout.info.infos[p];
+                return BitsetSpan<uint64_t>(rows.data() + size_t(v - first) * num_blocks + info.block_offset, info.num_bits);
+            };
+
+            const auto is_edge = [&](uint_t vi, uint_t vj)
+            { return consistent_literals(details::Edge(get_vertex(vi), get_vertex(vj)), indexed_literals, static_assignment_sets.predicate); };
+
+            // Each pair of partitions (pi, pj) writes the blocks of pj in the rows of pi and vice versa, which are disjoint across pairs.
+            // Pairs of vertices in the chunk are tested once and set in both rows. Pairs with one vertex outside of the chunk are tested again
+            // when the chunk of that vertex is computed.
+            oneapi::tbb::parallel_for_each(partition_pairs.begin(),
+                                           partition_pairs.end(),
+                                           [&](auto&& partition_pair)
+                                           {
+                                               const auto [pi, pj] = partition_pair;
+                                               const auto pi_first = std::max(offsets[pi], first);
+                                               const auto pi_last = std::min(offsets[pi + 1], last);
+                                               const auto pj_first = std::max(offsets[pj], first);
+                                               const auto pj_last = std::min(offsets[pj + 1], last);
+
+                                               for (uint_t vi = pi_first; vi < pi_last; ++vi)
+                                               {
+                                                   for (uint_t vj = offsets[pj]; vj < offsets[pj + 1]; ++vj)
+                                                   {
+                                                       if (!is_edge(vi, vj))
+                                                           continue;
+
+                                                       get_bitset(vi, pj).set(vj - offsets[pj]);
+
+                                                       if (pj_first <= vj && vj < pj_last)
+                                                           get_bitset(vj, pi).set(vi - offsets[pi]);
+                                                   }
+                                               }
+
+                                               for (uint_t vj = pj_first; vj < pj_last; ++vj)
+                                               {
+                                                   for (uint_t vi = offsets[pi]; vi < offsets[pi + 1]; ++vi)
+                                                   {
+                                                       if (pi_first <= vi && vi < pi_last)
+                                                           continue;  ///< already tested above
+
+                                                       if (is_edge(vi, vj))
+                                                           get_bitset(vj, pi).set(vi - offsets[pi]);
+                                                   }
+                                               }
+                                           });
+        });
 }
 
 template<f::FactKind T>
@@ -1315,13 +1356,14 @@ void StaticConsistencyGraph::initialize_dynamic_consistency_graphs(const Assignm
                     const auto full_affected_partition_j = full_graph.affected_partitions.get_bitset(info_j);
                     auto delta_affected_partition_j = delta_graph.affected_partitions.get_bitset(info_j);
 
-                    const auto static_edges = m_matrix.get_bitset(vi, pj);
                     auto full_edges_i = full_graph.matrix.get_bitset(vi, pj);
                     auto delta_edges_i = delta_graph.matrix.get_bitset(vi, pj);
                     auto delta_touched_i = delta_graph.matrix.touched_partitions(vi, pj);
                     auto full_touched_i = full_graph.matrix.touched_partitions(vi, pj);
 
-                    for_each_bit(
+                    m_matrix.for_each_bit(
+                        vi,
+                        pj,
                         [&](auto&& bj)
                         {
                             const auto vj = offset_j + bj;
@@ -1368,8 +1410,6 @@ void StaticConsistencyGraph::initialize_dynamic_consistency_graphs(const Assignm
                                 // ++T.delta_consistent_edges;
                             }
                         },
-                        [](auto&& a, auto&& b, auto&& c) noexcept { return a & b & ~c; },
-                        static_edges,
                         full_affected_partition_j,
                         full_edges_i);
 
@@ -1462,6 +1502,12 @@ const details::LiteralToRuleInfos& StaticConsistencyGraph::get_predicate_to_anch
 
 const kpkc::DeduplicatedAdjacencyMatrix& StaticConsistencyGraph::get_adjacency_matrix() const noexcept { return m_matrix; }
 
+size_t StaticConsistencyGraph::memory_usage() const noexcept
+{
+    return get_memory_usage(m_vertices) + get_memory_usage(m_vertex_partitions) + get_memory_usage(m_object_to_vertex_per_partition) + m_layout.memory_usage()
+           + m_matrix.memory_usage();
+}
+
 namespace
 {
 std::pair<fd::ConjunctiveConditionView, bool>
@@ -19,6 +19,8 @@
 #include "tyr/datalog/delta_kpkc.hpp"
 #include "tyr/formalism/datalog/expression_arity.hpp"
 
+#include <oneapi/tbb/parallel_for.h>
+
 namespace f = tyr::formalism;
 namespace fd = tyr::formalism::datalog;
 
@@ -97,4 +99,148 @@ Workspace::Workspace(const GraphLayout& graph) :
 {
 }
 
+/**
+ * DeduplicatedAdjacencyMatrix
+ */
+
+DeduplicatedAdjacencyMatrix::DeduplicatedAdjacencyMatrix(const GraphLayout& layout, const ComputeRows& compute_rows) : DeduplicatedAdjacencyMatrix(layout)
+{
+    const auto nv = m_layout.nv;
+    const auto k = m_layout.k;
+    const auto num_blocks = m_layout.info.num_blocks;
+
+    /// The rows of a chunk are computed into a scratch buffer of at most `max_chunk_blocks` blocks.
+    constexpr size_t max_chunk_blocks = size_t(1) << 17;
+    const auto chunk_size = std::max(size_t(1), max_chunk_blocks / std::max(num_blocks, size_t(1)));
+    const auto max_chunk_rows = std::min(chunk_size, nv);
+
+    auto chunk = std::vector<uint64_t>(max_chunk_rows * num_blocks);
+    auto partition_ids = std::vector<uint_t>(max_chunk_rows * k);  ///< partition_ids[i * k + p] identifies the adjacency from row i into p in the chunk.
+    auto partition_bitsets = std::vector<std::vector<BitsetSpan<const uint64_t>>>(k);
+    auto partition_cells = std::vector<UnorderedMap<size_t, Cell>>(k);  ///< Maps the hash of an adjacency into p to its first cell.
+    auto row_to_offset = UnorderedMap<size_t, uint_t> {};               ///< Maps the hash of a row to its first offset.
+    auto chunk_cells = std::vector<Cell> {};                            ///< chunk_cells[partition_begin[p] + id] is the cell of the adjacency id into p.
+    auto partition_begin = std::vector<size_t>(k);
+    auto row_cells = std::vector<uint_t>(k);
+
+    for (size_t first = 0; first < nv; first += chunk_size)
+    {
+        const auto last = std::min(first + chunk_size, nv);
+        const auto num_rows = last - first;
+
+        std::fill(chunk.begin(), chunk.end(), uint64_t(0));
+
+        compute_rows(uint_t(first), uint_t(last), std::span<uint64_t>(chunk.data(), num_rows * num_blocks));
+
+        /// Pass 1: deduplicate the adjacencies of the chunk into each partition independently.
+        oneapi::tbb::parallel_for(size_t(0),
+                                  k,
+                                  [&](size_t p)
+                                  {
+                                      const auto& info = m_layout.info.infos[p];
+                                      auto bitset_to_id = UnorderedMap<BitsetSpan<const uint64_t>, uint_t> {};
+
+                                      partition_bitsets[p].clear();
+
+                                      for (size_t i = 0; i < num_rows; ++i)
+                                      {
+                                          const auto b = BitsetSpan<const uint64_t>(chunk.data() + i * num_blocks + info.block_offset, info.num_bits);
+                                          const auto [it, inserted] = bitset_to_id.emplace(b, partition_bitsets[p].size());
+
+                                          if (inserted)
+                                              partition_bitsets[p].push_back(b);
+
+                                          partition_ids[i * k + p] = it->second;
+                                      }
+                                  });
+
+        /// Pass 2: assign offsets to the unique adjacencies of the chunk and deduplicate the rows by their cells.
+        chunk_cells.clear();
+        for (uint_t p = 0; p < k; ++p)
+        {
+            partition_begin[p] = chunk_cells.size();
+            for (const auto& b : partition_bitsets[p])
+                chunk_cells.push_back(get_or_create_cell(b, partition_cells[p]));
+        }
+
+        for (size_t i = 0; i < num_rows; ++i)
+        {
+            for (uint_t p = 0; p < k; ++p)
+                row_cells[p] = chunk_cells[partition_begin[p] + partition_ids[i * k + p]].value;
+
+            append_row(row_cells, row_to_offset);
+        }
+    }
+}
+
+DeduplicatedAdjacencyMatrix::DeduplicatedAdjacencyMatrix(const AdjacencyMatrix& m) :
+    DeduplicatedAdjacencyMatrix(m.layout(),
+                                [&](uint_t first, uint_t last, std::span<uint64_t> rows)
+                                {
+                                    const auto num_blocks = m.layout().info.num_blocks;
+
+                                    oneapi::tbb::parallel_for(first,
+                                                              last,
+                                                              [&](uint_t v)
+                                                              { std::ranges::copy(m.get_row(v), rows.begin() + size_t(v - first) * num_blocks); });
+                                })
+{
+}
+
+DeduplicatedAdjacencyMatrix::Cell DeduplicatedAdjacencyMatrix::get_or_create_cell(BitsetSpan<const uint64_t> b, UnorderedMap<size_t, Cell>& cells)
+{
+    /* Distinct adjacencies with equal hashes are not shared, which only costs memory. */
+
+    const auto [it, inserted] = cells.emplace(Hash<BitsetSpan<const uint64_t>> {}(b), Cell {});
+
+    if (inserted)
+        it->second = create_cell(b);
+
+    return (inserted || is_equal(it->second, b)) ? it->second : create_cell(b);
+}
+
+void DeduplicatedAdjacencyMatrix::append_row(std::span<const uint_t> row_cells, UnorderedMap<size_t, uint_t>& row_to_offset)
+{
+    const auto [it, inserted] = row_to_offset.emplace(Hash<std::span<const uint_t>> {}(row_cells), uint_t(m_row_data.size()));
+
+    if (!inserted && std::equal(row_cells.begin(), row_cells.end(), m_row_data.begin() + it->second))
+    {
+        m_row_offset.push_back(it->second);  ///< succeeded row deduplication
+        return;
+    }
+
+    m_row_offset.push_back(uint_t(m_row_data.size()));
+    m_row_data.insert(m_row_data.end(), row_cells.begin(), row_cells.end());
+}
+
+DeduplicatedAdjacencyMatrix::Cell DeduplicatedAdjacencyMatrix::create_cell(BitsetSpan<const uint64_t> b)
+{
+    const auto num_bits = b.count();
+
+    if (num_bits * sizeof(uint_t) < b.blocks().size() * sizeof(uint64_t))
+    {
+        const auto cell = Cell { uint_t(m_sparse_offsets.size() - 1) };
+        tyr::for_each_bit([&](auto&& bit) { m_sparse_data.push_back(uint_t(bit)); }, [](auto&& a) noexcept { return a; }, b);
+        m_sparse_offsets.push_back(uint_t(m_sparse_data.size()));
+        return cell;
+    }
+
+    assert(m_bitset_data.size() < Cell::DENSE);
+
+    const auto cell = Cell { uint_t(m_bitset_data.size()) | Cell::DENSE };
+    m_bitset_data.insert(m_bitset_data.end(), b.blocks().begin(), b.blocks().end());
+    return cell;
+}
+
+bool DeduplicatedAdjacencyMatrix::is_equal(Cell cell, BitsetSpan<const uint64_t> b) const noexcept
+{
+    if (cell.is_dense())
+        return std::equal(b.blocks().begin(), b.blocks().end(), m_bitset_data.begin() + cell.get_index());
+
+    const auto bits = get_sparse_bits(cell);
+    if (bits.size() != b.count())
+        return false;
+    return std::all_of(bits.begin(), bits.end(), [&](auto bit) { return b.test(bit); });
+}
+
 }
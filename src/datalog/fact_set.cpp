@@ -49,6 +49,12 @@ void PredicateFactSet<T>::reset() noexcept
     m_bitset.reset();
 }
 
+template<f::FactKind T>
+size_t PredicateFactSet<T>::memory_usage() const noexcept
+{
+    return get_memory_usage(m_bindings) + get_memory_usage(m_bitset);
+}
+
 template<f::FactKind T>
 void PredicateFactSet<T>::insert(const PredicateFactSet<T>& other)
 {
@@ -125,6 +131,15 @@ void PredicateFactSets<T>::reset() noexcept
         set.reset();
 }
 
+template<f::FactKind T>
+size_t PredicateFactSets<T>::memory_usage() const noexcept
+{
+    auto bytes = m_sets.capacity() * sizeof(PredicateFactSet<T>);
+    for (const auto& set : m_sets)
+        bytes += set.memory_usage();
+    return bytes;
+}
+
 template<f::FactKind T>
 void PredicateFactSets<T>::insert(const PredicateFactSets<T>& other)
 {
@@ -190,6 +205,12 @@ void FunctionFactSet<T>::reset() noexcept
     m_values.clear();
 }
 
+template<f::FactKind T>
+size_t FunctionFactSet<T>::memory_usage() const noexcept
+{
+    return get_memory_usage(m_remap) + get_memory_usage(m_bindings) + get_memory_usage(m_values);
+}
+
 template<f::FactKind T>
 void FunctionFactSet<T>::insert(const FunctionFactSet& other)
 {
@@ -304,6 +325,15 @@ void FunctionFactSets<T>::reset() noexcept
         set.reset();
 }
 
+template<f::FactKind T>
+size_t FunctionFactSets<T>::memory_usage() const noexcept
+{
+    auto bytes = m_sets.capacity() * sizeof(FunctionFactSet<T>);
+    for (const auto& set : m_sets)
+        bytes += set.memory_usage();
+    return bytes;
+}
+
 template<f::FactKind T>
 void FunctionFactSets<T>::insert(const FunctionFactSets& other)
 {
@@ -394,6 +424,12 @@ void TaggedFactSets<T>::reset() noexcept
     function.reset();
 }
 
+template<f::FactKind T>
+size_t TaggedFactSets<T>::memory_usage() const noexcept
+{
+    return predicate.memory_usage() + function.memory_usage();
+}
+
 template class TaggedFactSets<f::StaticTag>;
 template class TaggedFactSets<f::FluentTag>;
 
@@ -24,6 +24,7 @@
 #include "tyr/datalog/delta_kpkc.hpp"
 #include "tyr/datalog/delta_kpkc_graph.hpp"
 #include "tyr/datalog/formatter.hpp"
+#include "tyr/datalog/statistics/memory.hpp"
 #include "tyr/datalog/statistics/program.hpp"
 #include "tyr/datalog/statistics/rule.hpp"
 #include "tyr/formalism/datalog/views.hpp"
@@ -261,7 +262,12 @@ std::ostream& print(std::ostream& os, const datalog::kpkc::DeduplicatedAdjacency
             os << print_indent << v << ": [";
 
             for (uint_t p = 0; p < el.layout().k; ++p)
-                os << el.get_bitset(v, p) << ", ";
+            {
+                auto blocks = std::vector<uint64_t>(el.layout().info.infos[p].num_blocks, 0);
+                auto bitset = BitsetSpan<uint64_t>(blocks.data(), el.layout().info.infos[p].num_bits);
+                el.for_each_bit(v, p, [&](auto&& bit) { bitset.set(bit); });
+                os << bitset << ", ";
+            }
             os << "]\n";
         }
         os << "]\n";
@@ -313,6 +319,29 @@ std::ostream& print(std::ostream& os, const datalog::kpkc::PartitionedAdjacencyM
     return os;
 }
 
+std::ostream& print(std::ostream& os, const datalog::MemoryStatistics& el)
+{
+    fmt::print(os,
+               "[MemoryStatistics] M_repo    = {:>12} B | workspace repository\n"
+               "[MemoryStatistics] M_facts   = {:>12} B | fact and assignment sets\n"
+               "[MemoryStatistics] M_annot   = {:>12} B | program annotations\n"
+               "[MemoryStatistics] M_overlay = {:>12} B | rule overlay repositories\n"
+               "[MemoryStatistics] M_rannot  = {:>12} B | rule annotations\n"
+               "[MemoryStatistics] M_pending = {:>12} B | pending rules\n"
+               "[MemoryStatistics] M_kpkc    = {:>12} B | kpkc graphs and workspaces\n"
+               "[MemoryStatistics] M_tot     = {:>12} B | total",
+               el.workspace_repository,
+               el.facts,
+               el.annotations,
+               el.overlay_repositories,
+               el.rule_annotations,
+               el.pending_rules,
+               el.kpkc,
+               el.total());
+
+    return os;
+}
+
 std::ostream& print(std::ostream& os, const datalog::ProgramStatistics& el)
 {
     const double parallel_ns = static_cast<double>(to_ns(el.parallel_time));
@@ -335,6 +364,22 @@ std::ostream& print(std::ostream& os, const datalog::ProgramStatistics& el)
                avg_total_us,
                frac);
 
+    // Hardware counters are only printed if compiled in and available.
+    if (!el.total_counters.empty())
+        fmt::print(os,
+                   "\n[ProgramStatistics] IPC    = {:>10.2f}    | instructions per cycle (calling thread)\n"
+                   "[ProgramStatistics] CM     = {:>10}    | cache misses (calling thread)\n"
+                   "[ProgramStatistics] BM     = {:>10}    | branch misses (calling thread)\n"
+                   "[ProgramStatistics] IPC_m  = {:>10.2f}    | instructions per cycle in merge\n"
+                   "[ProgramStatistics] CM_m   = {:>10}    | cache misses in merge\n"
+                   "[ProgramStatistics] BM_m   = {:>10}    | branch misses in merge",
+                   el.total_counters.ipc(),
+                   el.total_counters.cache_misses,
+                   el.total_counters.branch_misses,
+                   el.merge_counters.ipc(),
+                   el.merge_counters.cache_misses,
+                   el.merge_counters.branch_misses);
+
     return os;
 }
 
@@ -405,6 +450,16 @@ std::ostream& print(std::ostream& os, const datalog::AggregatedRuleStatistics& e
                to_us(el.avg_time_median),
                avg_skew);
 
+    // Hardware counters are only printed if compiled in and available.
+    if (!el.process_generate_counters.empty())
+        fmt::print(os,
+                   "\n[AggregatedRuleStatistics] IPC_par    = {:>10.2f}    | instructions per cycle in parallel time\n"
+                   "[AggregatedRuleStatistics] CM_par     = {:>10}    | cache misses in parallel time\n"
+                   "[AggregatedRuleStatistics] BM_par     = {:>10}    | branch misses in parallel time",
+                   el.process_generate_counters.ipc(),
+                   el.process_generate_counters.cache_misses,
+                   el.process_generate_counters.branch_misses);
+
     return os;
 }
 
@@ -497,6 +552,8 @@ std::ostream& operator<<(std::ostream& os, const DeduplicatedAdjacencyMatrix& el
 std::ostream& operator<<(std::ostream& os, const PartitionedAdjacencyMatrix& el) { return print(os, el); }
 }
 
+std::ostream& operator<<(std::ostream& os, const MemoryStatistics& el) { return print(os, el); }
+
 std::ostream& operator<<(std::ostream& os, const ProgramStatistics& el) { return print(os, el); }
 
 std::ostream& operator<<(std::ostream& os, const RuleStatistics& el) { return print(os, el); }
@@ -149,6 +149,7 @@ uint_t fetch_atom_cost(formalism::datalog::PredicateBindingView<formalism::Fluen
 
 template<typename AggregationFunction>
 std::optional<Witness> try_ground_better_witness(uint_t best_cost,
+                                                 uint_t rule_cost,
                                                  formalism::datalog::RuleView rule,
                                                  formalism::datalog::ConjunctiveConditionView witness_condition,
                                                  formalism::datalog::GrounderContext& delta_context,
@@ -156,7 +157,6 @@ std::optional<Witness> try_ground_better_witness(uint_t best_cost,
                                                  const OrAnnotationsList& or_annot)
 {
     auto body_cost = AggregationFunction::identity();
-    const auto rule_cost = rule.get_cost();
 
     if (best_cost <= body_cost + rule_cost)
         return std::nullopt;  ///< No local or global improvement
@@ -184,6 +184,20 @@ std::optional<Witness> try_ground_better_witness(uint_t best_cost,
 }
 }
 
+template<typename AggregationFunction>
+AndAnnotationPolicy<AggregationFunction>::AndAnnotationPolicy(std::shared_ptr<const std::vector<Cost>> rule_costs) : m_rule_costs(std::move(rule_costs))
+{
+}
+
+template<typename AggregationFunction>
+Cost AndAnnotationPolicy<AggregationFunction>::get_rule_cost(formalism::datalog::RuleView rule) const noexcept
+{
+    if (m_rule_costs)
+        return tyr::get(uint_t(rule.get_index()), *m_rule_costs, Cost(rule.get_cost()));
+
+    return rule.get_cost();
+}
+
 template<typename AggregationFunction>
 void AndAnnotationPolicy<AggregationFunction>::update_annotation(formalism::datalog::PredicateBindingView<formalism::FluentTag> program_head,
                                                                  formalism::datalog::PredicateBindingView<formalism::FluentTag> delta_head,
@@ -199,12 +213,14 @@ void AndAnnotationPolicy<AggregationFunction>::update_annotation(formalism::data
     const auto best_global_cost = fetch_atom_cost(program_head, or_annot);
     const auto best_local_cost = fetch_current_best_cost(delta_head, delta_and_annot);
     const auto best_cost = std::min(best_global_cost, best_local_cost);
-    const auto cur_cost_lower_bound = current_cost + rule.get_cost();
+    const auto rule_cost = get_rule_cost(rule);
+    const auto cur_cost_lower_bound = current_cost + rule_cost;
 
     if (best_cost <= cur_cost_lower_bound)
         return;  ///< No local or global improvement
 
-    const auto witness = try_ground_better_witness<AggregationFunction>(best_cost, rule, witness_condition, delta_context, iteration_context, or_annot);
+    const auto witness =
+        try_ground_better_witness<AggregationFunction>(best_cost, rule_cost, rule, witness_condition, delta_context, iteration_context, or_annot);
     if (!witness)
         return;  ///< No local or global improvement
 
@@ -22,6 +22,7 @@
 #include "tyr/formalism/datalog/formatter.hpp"
 #include "tyr/formalism/datalog/views.hpp"  // for View
 
+#include <algorithm>      // for stable_sort, erase_if
 #include <assert.h>       // for assert
 #include <gtl/phmap.hpp>  // for operator!=, flat_hash_set
 #include <utility>        // for pair
@@ -37,13 +38,25 @@ RuleSchedulerStratum::RuleSchedulerStratum(const analysis::RuleStratum& rules, c
     m_listeners(listeners),
     m_context(context),
     m_active_predicates(),
-    m_active_rules()
+    m_active_rules_set(),
+    m_active_rules(),
+    m_active_rule_batches(),
+    m_time_estimates(),
+    m_total_times()
 {
     for (const auto rule : rules)
     {
         const auto predicate = uint_t(make_view(rule, context).get_head().get_predicate().get_index());
         if (predicate >= m_active_predicates.size())
             m_active_predicates.resize(predicate + 1, false);
+
+        const auto i = uint_t(rule);
+        if (i >= m_active_rules_set.size())
+        {
+            m_active_rules_set.resize(i + 1, false);
+            m_time_estimates.resize(i + 1, std::chrono::nanoseconds(-1));
+            m_total_times.resize(i + 1, std::chrono::nanoseconds(0));
+        }
     }
 }
 
@@ -51,36 +64,198 @@ void RuleSchedulerStratum::activate_all()
 {
     m_active_rules.clear();
     for (const auto rule : m_rules)
-        m_active_rules.insert(rule);
+        m_active_rules.push_back(rule);
+
+    order_active_rules();
 }
 
 void RuleSchedulerStratum::on_start_iteration() noexcept { m_active_predicates.reset(); }
 
 void RuleSchedulerStratum::on_generate(Index<f::Predicate<f::FluentTag>> predicate)
 {
-    assert(uint_t(predicate) < m_active_predicates.size());
-
-    m_active_predicates.set(uint_t(predicate));
+    // Heads of concurrently running strata are ignored because this stratum does not listen to them.
+    if (uint_t(predicate) < m_active_predicates.size())
+        m_active_predicates.set(uint_t(predicate));
 }
 
 void RuleSchedulerStratum::on_finish_iteration()
 {
     m_active_rules.clear();
+    m_active_rules_set.reset();
     for (auto i = m_active_predicates.find_first(); i != boost::dynamic_bitset<>::npos; i = m_active_predicates.find_next(i))
         if (const auto it = m_listeners.find(Index<f::Predicate<f::FluentTag>>(i)); it != m_listeners.end())
             for (const auto rule : it->second)
-                m_active_rules.insert(rule);
+                if (!m_active_rules_set.test_set(uint_t(rule)))
+                    m_active_rules.push_back(rule);
+
+    order_active_rules();
+}
+
+void RuleSchedulerStratum::update_time_estimate(Index<fd::Rule> rule, std::chrono::nanoseconds total_time) noexcept
+{
+    const auto i = uint_t(rule);
+    assert(i < m_time_estimates.size());
+
+    const auto time = total_time - m_total_times[i];
+    m_total_times[i] = total_time;
+
+    auto& estimate = m_time_estimates[i];
+    estimate = (estimate.count() < 0) ? time : (3 * estimate + time) / 4;
+}
+
+std::chrono::nanoseconds RuleSchedulerStratum::get_time_estimate(Index<fd::Rule> rule) const noexcept
+{
+    const auto estimate = m_time_estimates[uint_t(rule)];
+
+    return (estimate.count() < 0) ? std::chrono::nanoseconds::max() : estimate;
+}
+
+void RuleSchedulerStratum::order_active_rules()
+{
+    std::stable_sort(m_active_rules.begin(),
+                     m_active_rules.end(),
+                     [&](auto&& lhs, auto&& rhs) { return get_time_estimate(lhs) > get_time_estimate(rhs); });
+
+    m_active_rule_batches.clear();
+
+    auto begin = size_t(0);
+    auto batch_time = std::chrono::nanoseconds(0);
+    for (size_t end = 0; end < m_active_rules.size(); ++end)
+    {
+        const auto time = get_time_estimate(m_active_rules[end]);
+        batch_time = (time >= BATCH_TIME) ? BATCH_TIME : batch_time + time;
+
+        if (batch_time >= BATCH_TIME || end + 1 == m_active_rules.size())
+        {
+            m_active_rule_batches.emplace_back(m_active_rules.data() + begin, end + 1 - begin);
+            begin = end + 1;
+            batch_time = std::chrono::nanoseconds(0);
+        }
+    }
 }
 
-RuleSchedulerStrata create_schedulers(const analysis::RuleStrata& rules, const analysis::ListenerStrata& listeners, const fd::Repository& context)
+RuleSchedulerStrata::RuleSchedulerStrata(const analysis::RuleStrata& rules,
+                                         const analysis::ListenerStrata& listeners,
+                                         const fd::Repository& context,
+                                         bool concurrent) :
+    m_strata(),
+    m_concurrent(concurrent),
+    m_dependents(),
+    m_num_dependencies(),
+    m_num_pending(),
+    m_generated_predicates(),
+    m_running(),
+    m_finished()
 {
     assert(rules.data.size() == listeners.data.size());
+    assert(rules.components.size() == listeners.components.size());
+    assert(rules.components.size() == rules.dependencies.size());
+
+    const auto& strata = concurrent ? rules.components : rules.data;
+    const auto& strata_listeners = concurrent ? listeners.components : listeners.data;
+
+    m_strata.reserve(strata.size());
+    for (uint_t i = 0; i < strata.size(); ++i)
+        m_strata.emplace_back(strata[i], strata_listeners[i], context);
+
+    m_dependents.resize(strata.size());
+    m_num_dependencies.resize(strata.size(), 0);
+    m_num_pending.resize(strata.size(), 0);
+
+    for (uint_t i = 0; i < strata.size(); ++i)
+    {
+        if (concurrent)
+        {
+            for (const auto j : rules.dependencies[i])
+                m_dependents[j].push_back(i);
+            m_num_dependencies[i] = rules.dependencies[i].size();
+        }
+        else if (i > 0)
+        {
+            m_dependents[i - 1].push_back(i);
+            m_num_dependencies[i] = 1;
+        }
+
+        for (const auto rule : strata[i])
+        {
+            const auto predicate = uint_t(make_view(rule, context).get_head().get_predicate().get_index());
+            if (predicate >= m_generated_predicates.size())
+                m_generated_predicates.resize(predicate + 1, false);
+        }
+    }
+}
+
+void RuleSchedulerStrata::start()
+{
+    m_running.clear();
+    m_num_pending = m_num_dependencies;
+
+    for (uint_t i = 0; i < m_strata.size(); ++i)
+        if (m_num_pending[i] == 0)
+            start_stratum(i);
+}
+
+void RuleSchedulerStrata::finish_idle()
+{
+    m_finished.clear();
+    std::erase_if(m_running,
+                  [&](auto&& stratum)
+                  {
+                      if (!m_strata[stratum].get_active_rules().empty())
+                          return false;
+                      m_finished.push_back(stratum);
+                      return true;
+                  });
+
+    for (const auto stratum : m_finished)
+        finish_stratum(stratum);
+}
+
+void RuleSchedulerStrata::finish_all()
+{
+    m_finished.swap(m_running);
+    m_running.clear();
+
+    for (const auto stratum : m_finished)
+        finish_stratum(stratum);
+}
+
+void RuleSchedulerStrata::on_start_iteration() noexcept
+{
+    m_generated_predicates.reset();
+
+    for (const auto stratum : m_running)
+        m_strata[stratum].on_start_iteration();
+}
+
+void RuleSchedulerStrata::on_generate(Index<f::Predicate<f::FluentTag>> predicate)
+{
+    assert(uint_t(predicate) < m_generated_predicates.size());
+
+    if (m_generated_predicates.test_set(uint_t(predicate)))
+        return;
+
+    for (const auto stratum : m_running)
+        m_strata[stratum].on_generate(predicate);
+}
 
-    auto result = RuleSchedulerStrata {};
-    for (uint_t i = 0; i < rules.data.size(); ++i)
-        result.data.emplace_back(rules.data[i], listeners.data[i], context);
+void RuleSchedulerStrata::on_finish_iteration()
+{
+    for (const auto stratum : m_running)
+        m_strata[stratum].on_finish_iteration();
+}
 
-    return result;
+void RuleSchedulerStrata::start_stratum(uint_t stratum)
+{
+    m_strata[stratum].activate_all();
+    m_running.push_back(stratum);
+}
+
+void RuleSchedulerStrata::finish_stratum(uint_t stratum)
+{
+    for (const auto dependent : m_dependents[stratum])
+        if (--m_num_pending[dependent] == 0)
+            start_stratum(dependent);
 }
 
 }
@@ -46,6 +46,11 @@ void FactsWorkspace::reset()
     delta_fact_sets.reset();
 }
 
+size_t FactsWorkspace::memory_usage() const noexcept
+{
+    return fact_sets.memory_usage() + assignment_sets.memory_usage() + delta_fact_sets.memory_usage() + goal_fact_sets.memory_usage();
+}
+
 ConstFactsWorkspace::ConstFactsWorkspace(fd::PredicateListView<f::StaticTag> predicates,
                                          fd::FunctionListView<f::StaticTag> functions,
                                          const a::DomainListListList& predicate_domains,
@@ -59,4 +64,6 @@ ConstFactsWorkspace::ConstFactsWorkspace(fd::PredicateListView<f::StaticTag> pre
 {
 }
 
+size_t ConstFactsWorkspace::memory_usage() const noexcept { return fact_sets.memory_usage() + assignment_sets.memory_usage(); }
+
 }
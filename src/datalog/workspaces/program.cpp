@@ -17,6 +17,9 @@
 
 #include "tyr/datalog/workspaces/program.hpp"
 
+#include <oneapi/tbb/parallel_for.h>
+#include <stdexcept>
+
 namespace a = tyr::analysis;
 namespace f = tyr::formalism;
 namespace fd = tyr::formalism::datalog;
@@ -24,7 +27,12 @@ namespace fd = tyr::formalism::datalog;
 namespace tyr::datalog
 {
 template<typename OrAP, typename AndAP, typename TP>
-ProgramWorkspace<OrAP, AndAP, TP>::ProgramWorkspace(ProgramContext& context, const ConstProgramWorkspace& cws, OrAP or_ap, AndAP and_ap, TP tp) :
+ProgramWorkspace<OrAP, AndAP, TP>::ProgramWorkspace(ProgramContext& context,
+                                                    const ConstProgramWorkspace& cws,
+                                                    OrAP or_ap,
+                                                    AndAP and_ap,
+                                                    TP tp,
+                                                    bool concurrent_strata) :
     program_repository(context.get_program_repository()),
     workspace_repository(context.get_workspace_repository()),
     facts(context.get_program().get_predicates<formalism::FluentTag>(),
@@ -43,15 +51,33 @@ ProgramWorkspace<OrAP, AndAP, TP>::ProgramWorkspace(ProgramContext& context, con
     d2p(),
     planning_builder(),
     datalog_builder(),
-    schedulers(create_schedulers(context.get_strata(), context.get_listeners(), program_repository)),
+    schedulers(context.get_strata(), context.get_listeners(), program_repository, concurrent_strata),
     cost_buckets(),
     statistics()
 {
+    if (concurrent_strata && !CONCURRENT_STRATA)
+        throw std::runtime_error("ProgramWorkspace::ProgramWorkspace(...): Concurrent strata require programs without cost annotations.");
+
     for (uint_t i = 0; i < context.get_program().get_rules().size(); ++i)
         rules.emplace_back(
             std::make_unique<RuleWorkspace<AndAP>>(context.get_repository_factory(), program_repository, workspace_repository, cws.rules[i], and_ap));
 }
 
+template<typename OrAP, typename AndAP, typename TP>
+MemoryStatistics ProgramWorkspace<OrAP, AndAP, TP>::get_memory_statistics() const noexcept
+{
+    auto result = MemoryStatistics {};
+
+    result.workspace_repository = workspace_repository.memory_usage();
+    result.facts = facts.memory_usage();
+    result.annotations = get_memory_usage(or_annot) + get_memory_usage(and_annot);
+
+    for (const auto& rule : rules)
+        result += rule->get_memory_statistics();
+
+    return result;
+}
+
 template struct ProgramWorkspace<NoOrAnnotationPolicy, NoAndAnnotationPolicy, NoTerminationPolicy>;
 template struct ProgramWorkspace<OrAnnotationPolicy, AndAnnotationPolicy<SumAggregation>, NoTerminationPolicy>;
 template struct ProgramWorkspace<OrAnnotationPolicy, AndAnnotationPolicy<SumAggregation>, TerminationPolicy<SumAggregation>>;
@@ -69,13 +95,30 @@ ConstProgramWorkspace::ConstProgramWorkspace(ProgramContext& context) :
           context.get_program_repository()),
     rules()
 {
-    rules.reserve(context.get_program().get_rules().size());  // Ensure enough space to avoid move on reallocation
-    for (uint_t i = 0; i < context.get_program().get_rules().size(); ++i)
-        rules.emplace_back(context.get_program().get_rules()[i],
-                           context.get_workspace_repository(),
-                           context.get_domains().rule_domains[i],
-                           context.get_program().get_objects().size(),
-                           context.get_program().get_predicates<formalism::FluentTag>().size(),
-                           facts.assignment_sets);
+    const auto num_rules = context.get_program().get_rules().size();
+
+    // Create the auxiliary rules sequentially because they write into the repository.
+    rules.reserve(num_rules);  // Ensure enough space to avoid move on reallocation
+    for (uint_t i = 0; i < num_rules; ++i)
+        rules.emplace_back(context.get_program().get_rules()[i], context.get_workspace_repository());
+
+    // Compute the static consistency graphs in parallel because they only read from the repository.
+    oneapi::tbb::parallel_for(size_t(0),
+                              num_rules,
+                              [&](size_t i)
+                              {
+                                  rules[i].compute_static_consistency_graph(context.get_domains().rule_domains[i],
+                                                                            context.get_program().get_objects().size(),
+                                                                            context.get_program().get_predicates<formalism::FluentTag>().size(),
+                                                                            facts.assignment_sets);
+                              });
+}
+
+size_t ConstProgramWorkspace::memory_usage() const noexcept
+{
+    auto bytes = facts.memory_usage();
+    for (const auto& rule : rules)
+        bytes += rule.memory_usage();
+    return bytes;
 }
 }
@@ -74,12 +74,7 @@ auto create_witness_rule(fd::RuleView element, fd::Repository& context)
 }
 }
 
-ConstRuleWorkspace::ConstRuleWorkspace(fd::RuleView rule,
-                                       fd::Repository& repository,
-                                       const analysis::DomainListList& parameter_domains,
-                                       size_t num_objects,
-                                       size_t num_fluent_predicates,
-                                       const TaggedAssignmentSets<formalism::StaticTag>& static_assignment_sets) :
+ConstRuleWorkspace::ConstRuleWorkspace(fd::RuleView rule, fd::Repository& repository) :
     rule(rule),
     witness_rule(create_witness_rule(get_rule(), repository).first),
     nullary_condition(create_ground_nullary_conjunctive_condition(get_rule().get_body(), repository).first),
@@ -87,18 +82,26 @@ ConstRuleWorkspace::ConstRuleWorkspace(fd::RuleView rule,
     binary_overapproximation_rule(create_overapproximation_rule(2, get_rule(), repository).first),
     static_binary_overapproximation_rule(create_static_overapproximation_rule(2, get_rule(), repository).first),
     conflicting_overapproximation_rule(create_overapproximation_conflicting_rule(get_rule().get_arity() == 1 ? 1 : 2, get_rule(), repository).first),
-    static_consistency_graph(get_rule(),
-                             get_rule().get_body(),
-                             get_unary_overapproximation_rule().get_body(),
-                             get_binary_overapproximation_rule().get_body(),
-                             get_static_binary_overapproximation_rule().get_body(),
-                             parameter_domains,
-                             num_objects,
-                             num_fluent_predicates,
-                             0,
-                             get_rule().get_arity(),
-                             static_assignment_sets)
+    static_consistency_graph()
 {
 }
 
+void ConstRuleWorkspace::compute_static_consistency_graph(const analysis::DomainListList& parameter_domains,
+                                                          size_t num_objects,
+                                                          size_t num_fluent_predicates,
+                                                          const TaggedAssignmentSets<formalism::StaticTag>& static_assignment_sets)
+{
+    static_consistency_graph.emplace(get_rule(),
+                                     get_rule().get_body(),
+                                     get_unary_overapproximation_rule().get_body(),
+                                     get_binary_overapproximation_rule().get_body(),
+                                     get_static_binary_overapproximation_rule().get_body(),
+                                     parameter_domains,
+                                     num_objects,
+                                     num_fluent_predicates,
+                                     0,
+                                     get_rule().get_arity(),
+                                     static_assignment_sets);
+}
+
 }
@@ -115,9 +115,17 @@ SearchResult<Task> find_solution(Task& task, SuccessorGenerator<Task>& successor
     auto rng = std::mt19937_64(options.random_seed);
     auto& state_repository = *successor_generator.get_state_repository();
 
+    if (!pruning_strategy->preserves_optimality())
+        throw std::runtime_error("find_solution(...): pruning strategy does not preserve optimality.");
+
     auto result = SearchResult<Task>();
     auto search_nodes = SearchNodeVector<Task>();
     auto openlist = Queue<Task>();
+    const auto record_memory_usage = [&]
+    {
+        result.search_nodes_memory_usage = search_nodes.memory_usage();
+        result.openlist_memory_usage = openlist.memory_usage();
+    };
     const auto start_h_value = heuristic.evaluate(start_state);
     const auto start_f_value = start_node.get_metric() + start_h_value;
     auto& start_search_node = get_or_create_search_node(start_state_index, search_nodes);
@@ -131,6 +139,7 @@ SearchResult<Task> find_solution(Task& task, SuccessorGenerator<Task>& successor
     if (!goal_strategy->is_static_goal_satisfied())
     {
         event_handler->on_end_search();
+        record_memory_usage();
         event_handler->on_unsolvable();
 
         result.status = SearchStatus::UNSOLVABLE;
@@ -142,6 +151,7 @@ SearchResult<Task> find_solution(Task& task, SuccessorGenerator<Task>& successor
     if (goal_strategy->is_dynamic_goal_satisfied(start_state))
     {
         event_handler->on_end_search();
+        record_memory_usage();
 
         result.plan = Plan(start_node, LabeledNodeList<Task> {});
         result.goal_node = start_node;
@@ -155,6 +165,7 @@ SearchResult<Task> find_solution(Task& task, SuccessorGenerator<Task>& successor
     if (std::isnan(start_node.get_metric()))
     {
         event_handler->on_end_search();
+        record_memory_usage();
 
         throw std::runtime_error("find_solution(...): start node metric value is NaN.");
     }
@@ -164,6 +175,7 @@ SearchResult<Task> find_solution(Task& task, SuccessorGenerator<Task>& successor
     if (start_search_node.status == SearchNodeStatus::DEAD_END)
     {
         event_handler->on_end_search();
+        record_memory_usage();
         event_handler->on_unsolvable();
 
         result.status = SearchStatus::UNSOLVABLE;
@@ -175,6 +187,7 @@ SearchResult<Task> find_solution(Task& task, SuccessorGenerator<Task>& successor
     if (pruning_strategy->should_prune_state(start_state))
     {
         event_handler->on_end_search();
+        record_memory_usage();
         event_handler->on_unsolvable();
 
         result.status = SearchStatus::EXHAUSTED;
@@ -186,17 +199,34 @@ SearchResult<Task> find_solution(Task& task, SuccessorGenerator<Task>& successor
     openlist.insert(QueueEntry { start_f_value, start_state_index, start_search_node.status });
 
     auto stopwatch = options.max_time ? std::optional<CountdownWatch>(options.max_time.value()) : std::nullopt;
+    const auto memory_check_interval = std::max(options.memory_check_interval, uint_t(1));
+    auto num_iterations = uint_t(0);
 
     while (!openlist.empty())
     {
         if (stopwatch && stopwatch->has_finished())
         {
             event_handler->on_end_search();
+            record_memory_usage();
 
             result.status = SearchStatus::OUT_OF_TIME;
             return result;
         }
 
+        /* Test memory limit. */
+
+        if (options.max_memory_bytes && ++num_iterations % memory_check_interval == 0
+            && task.memory_usage() + successor_generator.memory_usage() + heuristic.memory_usage() + search_nodes.memory_usage() + openlist.memory_usage()
+                       + pruning_strategy->memory_usage()
+                   > options.max_memory_bytes.value())
+        {
+            event_handler->on_end_search();
+            record_memory_usage();
+
+            result.status = SearchStatus::OUT_OF_MEMORY;
+            return result;
+        }
+
         const auto [state_f_value, state_index] = openlist.top();
         const auto state = state_repository.get_registered_state(state_index);
 
@@ -226,6 +256,7 @@ SearchResult<Task> find_solution(Task& task, SuccessorGenerator<Task>& successor
             event_handler->on_expand_goal_node(node);
 
             event_handler->on_end_search();
+            record_memory_usage();
 
             result.plan = extract_total_ordered_plan(search_node, node, search_nodes, successor_generator);
             result.goal_node = node;
@@ -264,6 +295,7 @@ SearchResult<Task> find_solution(Task& task, SuccessorGenerator<Task>& successor
             if (is_new_successor_state && search_nodes.size() >= options.max_num_states)
             {
                 event_handler->on_end_search();
+                record_memory_usage();
 
                 result.status = SearchStatus::OUT_OF_STATES;
                 return result;
@@ -322,6 +354,7 @@ SearchResult<Task> find_solution(Task& task, SuccessorGenerator<Task>& successor
     }
 
     event_handler->on_end_search();
+    record_memory_usage();
     event_handler->on_exhausted();
 
     result.status = SearchStatus::EXHAUSTED;
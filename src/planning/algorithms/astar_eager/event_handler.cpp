@@ -25,6 +25,7 @@
 #include "tyr/planning/plan.hpp"
 
 #include <iostream>
+#include <limits>
 
 namespace tyr::planning::astar_eager
 {
@@ -124,4 +125,154 @@ DefaultEventHandlerPtr<Task> DefaultEventHandler<Task>::create(size_t verbosity)
 template class DefaultEventHandler<LiftedTask>;
 template class DefaultEventHandler<GroundTask>;
 
+/**
+ * JsonLinesEventHandler
+ */
+
+template<typename Task>
+JsonLinesEventHandler<Task>::JsonLinesEventHandler(ProgressWriter writer, EventHandlerPtr<Task> inner) :
+    m_writer(std::move(writer)),
+    m_inner(std::move(inner)),
+    m_statistics(),
+    m_f_value(std::numeric_limits<float_t>::quiet_NaN())
+{
+}
+
+template<typename Task>
+JsonLinesEventHandlerPtr<Task>
+JsonLinesEventHandler<Task>::create(int fd, std::chrono::milliseconds interval, ProgressProbe probe, EventHandlerPtr<Task> inner)
+{
+    return std::make_shared<JsonLinesEventHandler<Task>>(ProgressWriter(fd, interval, std::move(probe)), std::move(inner));
+}
+
+template<typename Task>
+void JsonLinesEventHandler<Task>::write(std::string_view event)
+{
+    m_writer.write(event, m_statistics, "f", m_f_value);
+}
+
+template<typename Task>
+void JsonLinesEventHandler<Task>::on_expand_node(const Node<Task>& node)
+{
+    m_statistics.increment_num_expanded();
+
+    if (m_inner)
+        m_inner->on_expand_node(node);
+
+    if (m_writer.is_due())
+        write("progress");
+}
+
+template<typename Task>
+void JsonLinesEventHandler<Task>::on_expand_goal_node(const Node<Task>& node)
+{
+    if (m_inner)
+        m_inner->on_expand_goal_node(node);
+}
+
+template<typename Task>
+void JsonLinesEventHandler<Task>::on_generate_node(const LabeledNode<Task>& labeled_succ_node)
+{
+    m_statistics.increment_num_generated();
+
+    if (m_inner)
+        m_inner->on_generate_node(labeled_succ_node);
+}
+
+template<typename Task>
+void JsonLinesEventHandler<Task>::on_generate_node_relaxed(const LabeledNode<Task>& labeled_succ_node)
+{
+    if (m_inner)
+        m_inner->on_generate_node_relaxed(labeled_succ_node);
+}
+
+template<typename Task>
+void JsonLinesEventHandler<Task>::on_generate_node_not_relaxed(const LabeledNode<Task>& labeled_succ_node)
+{
+    if (m_inner)
+        m_inner->on_generate_node_not_relaxed(labeled_succ_node);
+}
+
+template<typename Task>
+void JsonLinesEventHandler<Task>::on_close_node(const Node<Task>& node)
+{
+    if (m_inner)
+        m_inner->on_close_node(node);
+}
+
+template<typename Task>
+void JsonLinesEventHandler<Task>::on_prune_node(const Node<Task>& node)
+{
+    m_statistics.increment_num_pruned();
+
+    if (m_inner)
+        m_inner->on_prune_node(node);
+}
+
+template<typename Task>
+void JsonLinesEventHandler<Task>::on_start_search(const Node<Task>& node, float_t f_value)
+{
+    m_statistics = tyr::planning::Statistics();
+    m_statistics.set_search_start_time_point(std::chrono::high_resolution_clock::now());
+    m_f_value = f_value;
+
+    if (m_inner)
+        m_inner->on_start_search(node, f_value);
+
+    m_writer.start();
+    write("start");
+}
+
+template<typename Task>
+void JsonLinesEventHandler<Task>::on_finish_f_layer(float_t f_value)
+{
+    m_f_value = f_value;
+
+    if (m_inner)
+        m_inner->on_finish_f_layer(f_value);
+
+    write("f_layer");
+}
+
+template<typename Task>
+void JsonLinesEventHandler<Task>::on_end_search()
+{
+    m_statistics.set_search_end_time_point(std::chrono::high_resolution_clock::now());
+
+    if (m_inner)
+        m_inner->on_end_search();
+
+    write("end");
+}
+
+template<typename Task>
+void JsonLinesEventHandler<Task>::on_solved(const Plan<Task>& plan)
+{
+    if (m_inner)
+        m_inner->on_solved(plan);
+
+    write("solved");
+}
+
+template<typename Task>
+void JsonLinesEventHandler<Task>::on_unsolvable()
+{
+    if (m_inner)
+        m_inner->on_unsolvable();
+
+    write("unsolvable");
+}
+
+template<typename Task>
+void JsonLinesEventHandler<Task>::on_exhausted()
+{
+    if (m_inner)
+        m_inner->on_exhausted();
+
+    write("exhausted");
+}
+
+template class JsonLinesEventHandler<LiftedTask>;
+template class JsonLinesEventHandler<GroundTask>;
+
 }
@@ -45,6 +45,7 @@
 #include "tyr/planning/state_index.hpp"
 
 #include <algorithm>
+#include <optional>
 
 namespace tyr::planning::gbfs_lazy
 {
@@ -84,20 +85,33 @@ static SearchNode<Task>& get_or_create_search_node(Index<State<Task>> state_inde
  * GBFS queue
  */
 
+/// @brief The successor that results from applying the action in the parent state.
+///
+/// The successor state is only created and registered when the item is popped from the queue.
+/// The start state is represented by an item without action.
+template<typename Task>
+struct QueueItem
+{
+    Index<State<Task>> parent_state;
+    Index<formalism::planning::GroundAction> action;
+    bool preferred;
+};
+
 template<typename Task>
 struct QueueEntry
 {
-    using KeyType = std::tuple<float_t, float_t, uint_t, SearchNodeStatus>;
-    using ItemType = Index<State<Task>>;
+    using KeyType = std::tuple<float_t, float_t, uint_t>;
+    using ItemType = QueueItem<Task>;
 
-    float_t g_value;
-    float_t h_value;
-    Index<State<Task>> state;
+    float_t g_value;  ///< The g-value of the parent state.
+    float_t h_value;  ///< The h-value of the parent state.
+    Index<State<Task>> parent_state;
+    Index<formalism::planning::GroundAction> action;
     uint_t step;
-    SearchNodeStatus status;
+    bool preferred;
 
-    KeyType get_key() const { return std::make_tuple(h_value, g_value, step, status); }
-    ItemType get_item() const { return state; }
+    KeyType get_key() const { return std::make_tuple(h_value, g_value, step); }
+    ItemType get_item() const { return ItemType { parent_state, action, preferred }; }
 };
 
 static_assert(sizeof(QueueEntry<LiftedTask>) == 32);
@@ -124,6 +138,11 @@ SearchResult<Task> find_solution(Task& task, SuccessorGenerator<Task>& successor
     auto preferred_openlist = Queue<Task>();
     auto standard_openlist = Queue<Task>();
     auto openlist = AlternatingOpenList<Queue<Task>, Queue<Task>>(preferred_openlist, standard_openlist, std::array<size_t, 2> { 1, 1 });
+    const auto record_memory_usage = [&]
+    {
+        result.search_nodes_memory_usage = search_nodes.memory_usage();
+        result.openlist_memory_usage = openlist.memory_usage();
+    };
     const auto start_h_value = heuristic.evaluate(start_state);
     auto best_h_value = start_h_value;
     const auto start_preferred = false;
@@ -139,6 +158,7 @@ SearchResult<Task> find_solution(Task& task, SuccessorGenerator<Task>& successor
     if (!goal_strategy->is_static_goal_satisfied())
     {
         event_handler->on_end_search();
+        record_memory_usage();
         event_handler->on_unsolvable();
 
         result.status = SearchStatus::UNSOLVABLE;
@@ -150,6 +170,7 @@ SearchResult<Task> find_solution(Task& task, SuccessorGenerator<Task>& successor
     if (goal_strategy->is_dynamic_goal_satisfied(start_state))
     {
         event_handler->on_end_search();
+        record_memory_usage();
 
         result.plan = Plan(start_node, LabeledNodeList<Task> {});
         result.goal_node = start_node;
@@ -163,6 +184,7 @@ SearchResult<Task> find_solution(Task& task, SuccessorGenerator<Task>& successor
     if (std::isnan(start_node.get_metric()))
     {
         event_handler->on_end_search();
+        record_memory_usage();
 
         throw std::runtime_error("find_solution(...): start node metric value is NaN.");
     }
@@ -172,6 +194,7 @@ SearchResult<Task> find_solution(Task& task, SuccessorGenerator<Task>& successor
     if (start_search_node.status == SearchNodeStatus::DEAD_END)
     {
         event_handler->on_end_search();
+        record_memory_usage();
         event_handler->on_unsolvable();
 
         result.status = SearchStatus::UNSOLVABLE;
@@ -183,17 +206,22 @@ SearchResult<Task> find_solution(Task& task, SuccessorGenerator<Task>& successor
     if (pruning_strategy->should_prune_state(start_state))
     {
         event_handler->on_end_search();
+        record_memory_usage();
         event_handler->on_unsolvable();
 
         result.status = SearchStatus::EXHAUSTED;
         return result;
     }
 
-    auto labeled_succ_nodes = std::vector<LabeledNode<Task>> {};
+    auto applicable_actions = formalism::planning::GroundActionViewList {};
 
-    standard_openlist.insert(QueueEntry { start_node.get_metric(), start_h_value, start_state_index, step++, start_search_node.status });
+    const auto no_action = Index<formalism::planning::GroundAction>::max();
+
+    standard_openlist.insert(QueueEntry<Task> { start_node.get_metric(), start_h_value, start_state_index, no_action, step++, start_preferred });
 
     auto stopwatch = options.max_time ? std::optional<CountdownWatch>(options.max_time.value()) : std::nullopt;
+    const auto memory_check_interval = std::max(options.memory_check_interval, uint_t(1));
+    auto num_iterations = uint_t(0);
 
     auto& openlist_weights = openlist.get_weights();
 
@@ -202,61 +230,53 @@ SearchResult<Task> find_solution(Task& task, SuccessorGenerator<Task>& successor
         if (stopwatch && stopwatch->has_finished())
         {
             event_handler->on_end_search();
+            record_memory_usage();
 
             result.status = SearchStatus::OUT_OF_TIME;
             return result;
         }
 
-        const auto state_index = openlist.top();
-        const auto state = state_repository.get_registered_state(state_index);
+        /* Test memory limit. */
+
+        if (options.max_memory_bytes && ++num_iterations % memory_check_interval == 0
+            && task.memory_usage() + successor_generator.memory_usage() + heuristic.memory_usage() + search_nodes.memory_usage() + openlist.memory_usage()
+                       + pruning_strategy->memory_usage()
+                   > options.max_memory_bytes.value())
+        {
+            event_handler->on_end_search();
+            record_memory_usage();
+
+            result.status = SearchStatus::OUT_OF_MEMORY;
+            return result;
+        }
+
+        const auto item = openlist.top();
 
         openlist.pop();
         // Weight decay of prefered queue
         openlist_weights[0] = std::max(openlist_weights[0] - 1, size_t { 1 });
 
-        auto& search_node = get_or_create_search_node(state_index, search_nodes);
-        auto node = Node<Task>(state, search_node.g_value);
+        auto node = std::optional<Node<Task>> {};
 
-        /* Close state. */
-
-        if (search_node.status == SearchNodeStatus::CLOSED || search_node.status == SearchNodeStatus::DEAD_END)
+        if (item.action == no_action)
         {
-            continue;
-        }
-
-        /* Expand the successors of the node. */
+            auto& search_node = get_or_create_search_node(item.parent_state, search_nodes);
 
-        event_handler->on_expand_node(node);
+            if (search_node.status == SearchNodeStatus::CLOSED || search_node.status == SearchNodeStatus::DEAD_END)
+            {
+                continue;
+            }
 
-        const auto state_h_value = heuristic.evaluate(state);
-        if (state_h_value == std::numeric_limits<float_t>::infinity())
-        {
-            search_node.status = SearchNodeStatus::DEAD_END;
-            continue;
+            node.emplace(state_repository.get_registered_state(item.parent_state), search_node.g_value);
         }
-
-        if (state_h_value < best_h_value)
+        else
         {
-            best_h_value = state_h_value;
-            event_handler->on_new_best_h_value(best_h_value);
-
-            // Boost prefered queue
-            openlist_weights[0] += options.boost_preferred_queue;
-        }
-
-        const auto& preferred_actions = heuristic.get_preferred_actions();
+            /* Generate the successor state. */
 
-        /* Ensure that the state is closed */
-
-        search_node.status = SearchNodeStatus::CLOSED;
-
-        successor_generator.get_labeled_successor_nodes(node, labeled_succ_nodes);
-
-        if (options.shuffle_labeled_succ_nodes)
-            std::shuffle(labeled_succ_nodes.begin(), labeled_succ_nodes.end(), rng);
-
-        for (const auto& labeled_succ_node : labeled_succ_nodes)
-        {
+            const auto parent_node = Node<Task>(state_repository.get_registered_state(item.parent_state),
+                                                get_or_create_search_node(item.parent_state, search_nodes).g_value);
+            const auto action = make_view(item.action, *task.get_repository());
+            const auto labeled_succ_node = LabeledNode<Task> { action, successor_generator.get_successor_node(parent_node, action) };
             const auto& succ_node = labeled_succ_node.node;
             const auto& succ_state = succ_node.get_state();
             const auto succ_state_index = succ_state.get_index();
@@ -265,12 +285,12 @@ SearchResult<Task> find_solution(Task& task, SuccessorGenerator<Task>& successor
 
             assert(!std::isnan(succ_node.get_metric()));
 
-            const auto is_preferred = preferred_actions.contains(labeled_succ_node.label.get_index());
             const auto is_new_successor_state = (successor_search_node.status == SearchNodeStatus::NEW);
 
             if (is_new_successor_state && search_nodes.size() >= options.max_num_states)
             {
                 event_handler->on_end_search();
+                record_memory_usage();
 
                 result.status = SearchStatus::OUT_OF_STATES;
                 return result;
@@ -284,11 +304,11 @@ SearchResult<Task> find_solution(Task& task, SuccessorGenerator<Task>& successor
             /* Open new state. */
 
             successor_search_node.status = SearchNodeStatus::OPEN;
-            successor_search_node.parent_state = state_index;
+            successor_search_node.parent_state = item.parent_state;
             successor_search_node.g_value = succ_node.get_metric();
-            successor_search_node.preferred = is_preferred;
+            successor_search_node.preferred = item.preferred;
 
-            /* Early goal test. */
+            /* Goal test. */
 
             const auto successor_is_goal_state = goal_strategy->is_dynamic_goal_satisfied(succ_state);
 
@@ -299,6 +319,7 @@ SearchResult<Task> find_solution(Task& task, SuccessorGenerator<Task>& successor
                 event_handler->on_expand_goal_node(succ_node);
 
                 event_handler->on_end_search();
+                record_memory_usage();
 
                 result.plan = extract_total_ordered_plan(successor_search_node, succ_node, search_nodes, successor_generator);
                 result.goal_node = succ_node;
@@ -311,7 +332,7 @@ SearchResult<Task> find_solution(Task& task, SuccessorGenerator<Task>& successor
 
             /* Apply pruning strategy */
 
-            if (pruning_strategy->should_prune_successor_state(state, succ_state, is_new_successor_state))
+            if (pruning_strategy->should_prune_successor_state(parent_node.get_state(), succ_state, is_new_successor_state))
             {
                 event_handler->on_prune_node(succ_node);
                 continue;
@@ -319,16 +340,63 @@ SearchResult<Task> find_solution(Task& task, SuccessorGenerator<Task>& successor
 
             event_handler->on_generate_node(labeled_succ_node);
 
-            /* Exploration strategy */
+            node.emplace(succ_node);
+        }
+
+        const auto& state = node->get_state();
+        auto& search_node = get_or_create_search_node(state.get_index(), search_nodes);
+
+        /* Expand the successors of the node. */
+
+        event_handler->on_expand_node(*node);
+
+        const auto state_h_value = heuristic.evaluate(state);
+        if (state_h_value == std::numeric_limits<float_t>::infinity())
+        {
+            search_node.status = SearchNodeStatus::DEAD_END;
+            continue;
+        }
+
+        if (state_h_value < best_h_value)
+        {
+            best_h_value = state_h_value;
+            event_handler->on_new_best_h_value(best_h_value);
+
+            // Boost prefered queue
+            openlist_weights[0] += options.boost_preferred_queue;
+        }
+
+        const auto& preferred_actions = heuristic.get_preferred_actions();
+
+        /* Ensure that the state is closed */
+
+        search_node.status = SearchNodeStatus::CLOSED;
+
+        /* Enqueue the applicable actions, the successor states are created when they are dequeued. */
+
+        successor_generator.get_applicable_actions(*node, applicable_actions);
+
+        if (options.shuffle_labeled_succ_nodes)
+            std::shuffle(applicable_actions.begin(), applicable_actions.end(), rng);
+
+        const auto preferred_end = std::stable_partition(applicable_actions.begin(),
+                                                         applicable_actions.end(),
+                                                         [&](auto&& action) { return preferred_actions.contains(action.get_index()); });
+
+        for (auto it = applicable_actions.begin(); it != applicable_actions.end(); ++it)
+        {
+            const auto is_preferred = (it < preferred_end);
+            const auto entry = QueueEntry<Task> { node->get_metric(), state_h_value, state.get_index(), it->get_index(), step++, is_preferred };
 
             if (is_preferred)
-                preferred_openlist.insert(QueueEntry { succ_node.get_metric(), state_h_value, succ_state_index, step++, successor_search_node.status });
+                preferred_openlist.insert(entry);
             else
-                standard_openlist.insert(QueueEntry { succ_node.get_metric(), state_h_value, succ_state_index, step++, successor_search_node.status });
+                standard_openlist.insert(entry);
         }
     }
 
     event_handler->on_end_search();
+    record_memory_usage();
     event_handler->on_exhausted();
 
     result.status = SearchStatus::EXHAUSTED;
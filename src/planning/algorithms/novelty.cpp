@@ -0,0 +1,149 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "tyr/planning/algorithms/novelty.hpp"
+
+#include "tyr/planning/ground_task.hpp"
+#include "tyr/planning/ground_task/state_view.hpp"
+#include "tyr/planning/lifted_task.hpp"
+#include "tyr/planning/lifted_task/state_view.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+#include <stdexcept>
+
+namespace tyr::planning
+{
+
+/**
+ * FactIndexMapper
+ */
+
+template<typename Task>
+FactIndexMapper<Task>::FactIndexMapper() : m_fluent_fact_indices(), m_derived_atom_indices(), m_num_facts(0)
+{
+}
+
+template<typename Task>
+uint_t FactIndexMapper<Task>::get_or_create_index(uint_t& slot)
+{
+    if (slot == std::numeric_limits<uint_t>::max())
+        slot = m_num_facts++;
+    return slot;
+}
+
+template<typename Task>
+void FactIndexMapper<Task>::compute_fact_indices(const StateView<Task>& state, std::vector<uint_t>& out_fact_indices)
+{
+    out_fact_indices.clear();
+
+    for (const auto fact : state.get_fluent_facts())
+    {
+        const auto variable = uint_t(fact.variable);
+        const auto value = uint_t(fact.value);
+
+        if (variable >= m_fluent_fact_indices.size())
+            m_fluent_fact_indices.resize(variable + 1);
+        auto& value_indices = m_fluent_fact_indices[variable];
+        if (value >= value_indices.size())
+            value_indices.resize(value + 1, std::numeric_limits<uint_t>::max());
+
+        out_fact_indices.push_back(get_or_create_index(value_indices[value]));
+    }
+
+    for (const auto atom : state.get_derived_atoms())
+    {
+        const auto index = uint_t(atom);
+
+        if (index >= m_derived_atom_indices.size())
+            m_derived_atom_indices.resize(index + 1, std::numeric_limits<uint_t>::max());
+
+        out_fact_indices.push_back(get_or_create_index(m_derived_atom_indices[index]));
+    }
+}
+
+template class FactIndexMapper<LiftedTask>;
+template class FactIndexMapper<GroundTask>;
+
+/**
+ * NoveltyTable
+ */
+
+static size_t get_pair_index(uint_t a, uint_t b)
+{
+    assert(a < b);
+    return size_t(b) * (size_t(b) - 1) / 2 + a;
+}
+
+NoveltyTable::NoveltyTable(size_t arity) : m_arity(arity), m_singletons(), m_pairs()
+{
+    if (m_arity < 1 || m_arity > 2)
+        throw std::runtime_error("NoveltyTable::NoveltyTable(...): arity must be 1 or 2.");
+}
+
+size_t NoveltyTable::test_and_insert(const std::vector<uint_t>& fact_indices)
+{
+    auto novelty = m_arity + 1;
+
+    if (fact_indices.empty())
+        return novelty;
+
+    const auto max_index = *std::max_element(fact_indices.begin(), fact_indices.end());
+
+    if (max_index >= m_singletons.size())
+        m_singletons.resize(max_index + 1, false);
+
+    for (const auto a : fact_indices)
+    {
+        if (!m_singletons.test(a))
+        {
+            m_singletons.set(a);
+            novelty = 1;
+        }
+    }
+
+    if (m_arity < 2)
+        return novelty;
+
+    if (max_index > 0 && get_pair_index(0, max_index + 1) > m_pairs.size())
+        m_pairs.resize(get_pair_index(0, max_index + 1), false);
+
+    for (size_t i = 0; i < fact_indices.size(); ++i)
+    {
+        for (size_t j = i + 1; j < fact_indices.size(); ++j)
+        {
+            const auto pair_index = get_pair_index(std::min(fact_indices[i], fact_indices[j]), std::max(fact_indices[i], fact_indices[j]));
+
+            if (!m_pairs.test(pair_index))
+            {
+                m_pairs.set(pair_index);
+                novelty = std::min(novelty, size_t(2));
+            }
+        }
+    }
+
+    return novelty;
+}
+
+void NoveltyTable::clear()
+{
+    m_singletons.clear();
+    m_pairs.clear();
+}
+
+}
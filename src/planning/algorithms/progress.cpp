@@ -0,0 +1,131 @@
+/*
+ * Copyright (C) 2025 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "tyr/planning/algorithms/progress.hpp"
+
+#include "tyr/common/memory.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstddef>
+#include <fmt/format.h>
+#include <iterator>
+
+#if defined(_WIN32)
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace tyr::planning
+{
+
+/// @brief Write up to `size` bytes to the file descriptor and return the number of bytes written, or a negative value on error.
+static std::ptrdiff_t write_to_fd(int fd, const char* data, size_t size) noexcept
+{
+#if defined(_WIN32)
+    return ::_write(fd, data, static_cast<unsigned int>(std::min(size, size_t { 1u << 30 })));
+#else
+    return ::write(fd, data, size);
+#endif
+}
+
+ProgressWriter::ProgressWriter(int fd, std::chrono::milliseconds interval, ProgressProbe probe) :
+    m_fd(fd),
+    m_interval(interval),
+    m_probe(std::move(probe)),
+    m_start_time_point(),
+    m_last_time_point(),
+    m_next_time_point(),
+    m_last_num_expanded(0),
+    m_num_checks(0),
+    m_buffer()
+{
+}
+
+void ProgressWriter::start()
+{
+    m_start_time_point = std::chrono::steady_clock::now();
+    m_last_time_point = m_start_time_point;
+    m_next_time_point = m_start_time_point + m_interval;
+    m_last_num_expanded = 0;
+    m_num_checks = 0;
+}
+
+void ProgressWriter::write(std::string_view event, const Statistics& statistics, std::string_view value_name, float_t value)
+{
+    const auto now = std::chrono::steady_clock::now();
+    const auto sample = m_probe ? m_probe() : ProgressSample {};
+
+    const auto to_ms = [](auto duration) { return std::chrono::duration_cast<std::chrono::milliseconds>(duration).count(); };
+    const auto to_rate = [](uint64_t count, auto duration)
+    {
+        const auto seconds = std::chrono::duration<double>(duration).count();
+        return (seconds > 0.) ? count / seconds : 0.;
+    };
+
+    const auto num_expanded = statistics.get_num_expanded();
+
+    m_buffer.clear();
+    auto out = std::back_inserter(m_buffer);
+    fmt::format_to(out, R"({{"event":"{}","time_ms":{},"expanded":{},"generated":{},"pruned":{},"states":{},)",
+                   event,
+                   to_ms(now - m_start_time_point),
+                   num_expanded,
+                   statistics.get_num_generated(),
+                   statistics.get_num_pruned(),
+                   sample.num_states);
+    if (std::isfinite(value))
+        fmt::format_to(out, R"("{}":{},)", value_name, value);
+    else
+        fmt::format_to(out, R"("{}":null,)", value_name);
+    fmt::format_to(out,
+                   R"("expansions_per_second":{:.1f},"interval_expansions_per_second":{:.1f},"rss_bytes":{},"states_memory_bytes":{},)",
+                   to_rate(num_expanded, now - m_start_time_point),
+                   to_rate(num_expanded - m_last_num_expanded, now - m_last_time_point),
+                   get_current_memory_usage_in_bytes(),
+                   sample.states_memory_usage);
+    fmt::format_to(out,
+                   R"("successor_generator_ms":{},"axiom_evaluator_ms":{},"heuristic_ms":{}}})"
+                   "\n",
+                   to_ms(sample.successor_generator_time),
+                   to_ms(sample.axiom_evaluator_time),
+                   to_ms(sample.heuristic_time));
+
+    // Progress output is best effort: write errors must not abort the search.
+    const char* data = m_buffer.data();
+    auto remaining = m_buffer.size();
+    while (remaining > 0)
+    {
+        const auto written = write_to_fd(m_fd, data, remaining);
+        if (written < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            break;
+        }
+        data += written;
+        remaining -= static_cast<size_t>(written);
+    }
+
+    m_last_time_point = now;
+    m_next_time_point = now + m_interval;
+    m_last_num_expanded = num_expanded;
+}
+
+}
@@ -0,0 +1,157 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "tyr/planning/algorithms/siw.hpp"
+
+#include "tyr/planning/algorithms/iw.hpp"
+#include "tyr/planning/algorithms/iw/event_handler.hpp"
+#include "tyr/planning/algorithms/strategies/goal.hpp"
+#include "tyr/planning/algorithms/strategies/pruning.hpp"
+#include "tyr/planning/algorithms/utils.hpp"
+#include "tyr/planning/applicability.hpp"
+#include "tyr/planning/ground_task.hpp"
+#include "tyr/planning/ground_task/node.hpp"
+#include "tyr/planning/ground_task/state_view.hpp"
+#include "tyr/planning/ground_task/successor_generator.hpp"
+#include "tyr/planning/heuristics/goal_count.hpp"
+#include "tyr/planning/lifted_task.hpp"
+#include "tyr/planning/lifted_task/node.hpp"
+#include "tyr/planning/lifted_task/state_view.hpp"
+#include "tyr/planning/lifted_task/successor_generator.hpp"
+
+#include <chrono>
+
+namespace tyr::planning::siw
+{
+
+/// @brief `SubgoalStrategy` accepts states with fewer unsatisfied goals than the start state of the current subproblem.
+template<typename Task>
+class SubgoalStrategy : public GoalStrategy<Task>
+{
+public:
+    SubgoalStrategy(const Task& task, float_t num_unsatisfied_goals) : m_task(task), m_num_unsatisfied_goals(num_unsatisfied_goals) {}
+
+    static std::shared_ptr<SubgoalStrategy<Task>> create(const Task& task, float_t num_unsatisfied_goals)
+    {
+        return std::make_shared<SubgoalStrategy<Task>>(task, num_unsatisfied_goals);
+    }
+
+    bool is_static_goal_satisfied() override { return is_statically_applicable(m_task.get_task().get_goal(), m_task.get_static_atoms_bitset()); }
+    bool is_dynamic_goal_satisfied(const StateView<Task>& state) override
+    {
+        const auto state_context = StateContext { m_task, state.get_unpacked_state(), float_t { 0 } };
+        return count_unsatisfied_goals(m_task.get_task().get_goal(), state_context) < m_num_unsatisfied_goals;
+    }
+
+private:
+    const Task& m_task;
+    float_t m_num_unsatisfied_goals;
+};
+
+template<typename Task>
+SearchResult<Task> find_solution(Task& task, SuccessorGenerator<Task>& successor_generator, const Options<Task>& options)
+{
+    const auto start_node = (options.start_node) ? options.start_node.value() : successor_generator.get_initial_node();
+    const auto goal = task.get_task().get_goal();
+    const auto start_time_point = std::chrono::steady_clock::now();
+
+    auto result = SearchResult<Task>();
+
+    /* Test static goal. */
+
+    if (!is_statically_applicable(goal, task.get_static_atoms_bitset()))
+    {
+        result.status = SearchStatus::UNSOLVABLE;
+        return result;
+    }
+
+    auto node = start_node;
+    auto labeled_succ_nodes = LabeledNodeList<Task> {};
+
+    auto iw_options = iw::Options<Task>();
+    iw_options.event_handler = options.event_handler;
+    iw_options.pruning_strategy = options.pruning_strategy;
+    iw_options.max_num_states = options.max_num_states;
+    iw_options.random_seed = options.random_seed;
+    iw_options.shuffle_labeled_succ_nodes = options.shuffle_labeled_succ_nodes;
+
+    while (true)
+    {
+        const auto state_context = StateContext { task, node.get_state().get_unpacked_state(), float_t { 0 } };
+        const auto num_unsatisfied_goals = count_unsatisfied_goals(goal, state_context);
+
+        /* Test whether the current state is goal. */
+
+        if (num_unsatisfied_goals == 0)
+        {
+            result.plan = Plan(start_node, std::move(labeled_succ_nodes));
+            result.goal_node = node;
+            result.status = SearchStatus::SOLVED;
+            return result;
+        }
+
+        /* Solve the subproblem of achieving one more goal with increasing width. */
+
+        iw_options.start_node = node;
+        iw_options.goal_strategy = SubgoalStrategy<Task>::create(task, num_unsatisfied_goals);
+
+        auto iw_result = SearchResult<Task>();
+
+        for (uint_t width = 1; width <= options.max_width; ++width)
+        {
+            if (options.max_time)
+            {
+                const auto elapsed_time = std::chrono::steady_clock::now() - start_time_point;
+
+                if (elapsed_time >= options.max_time.value())
+                {
+                    result.status = SearchStatus::OUT_OF_TIME;
+                    return result;
+                }
+
+                iw_options.max_time = options.max_time.value() - elapsed_time;
+            }
+
+            iw_options.width = width;
+
+            iw_result = iw::find_solution(task, successor_generator, iw_options);
+
+            if (iw_result.status != SearchStatus::EXHAUSTED)
+                break;
+        }
+
+        if (iw_result.status != SearchStatus::SOLVED)
+        {
+            result.status = iw_result.status;
+            return result;
+        }
+
+        const auto& subplan = iw_result.plan.value().get_labeled_succ_nodes();
+        labeled_succ_nodes.insert(labeled_succ_nodes.end(), subplan.begin(), subplan.end());
+        node = iw_result.goal_node.value();
+    }
+}
+
+template SearchResult<LiftedTask> find_solution<LiftedTask>(LiftedTask& task,
+                                                            SuccessorGenerator<LiftedTask>& successor_generator,
+                                                            const Options<LiftedTask>& options);
+
+template SearchResult<GroundTask> find_solution<GroundTask>(GroundTask& task,
+                                                            SuccessorGenerator<GroundTask>& successor_generator,
+                                                            const Options<GroundTask>& options);
+
+}
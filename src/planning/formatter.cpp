@@ -68,12 +68,8 @@ std::ostream& print(std::ostream& os, const planning::GroundTask& el)
     return os;
 }
 
-std::ostream& print(std::ostream& os, const Data<planning::State<planning::LiftedTask>>& el) { return os; }
-
 std::ostream& print(std::ostream& os, const planning::UnpackedState<planning::LiftedTask>& el) { return os; }
 
-std::ostream& print(std::ostream& os, const Data<planning::State<planning::GroundTask>>& el) { return os; }
-
 std::ostream& print(std::ostream& os, const planning::UnpackedState<planning::GroundTask>& el) { return os; }
 
 std::ostream& print(std::ostream& os, const planning::Statistics& el)
@@ -92,6 +88,17 @@ std::ostream& print(std::ostream& os, const planning::Statistics& el)
     return os;
 }
 
+template<typename Task, typename Tag>
+std::ostream& print(std::ostream& os, const Data<planning::PackedState<Task, Tag>>& el)
+{
+    return os;
+}
+
+template std::ostream& print(std::ostream& os, const Data<planning::PackedState<planning::LiftedTask, planning::TreeCompression>>& el);
+template std::ostream& print(std::ostream& os, const Data<planning::PackedState<planning::LiftedTask, planning::HashSet>>& el);
+template std::ostream& print(std::ostream& os, const Data<planning::PackedState<planning::GroundTask, planning::TreeCompression>>& el);
+template std::ostream& print(std::ostream& os, const Data<planning::PackedState<planning::GroundTask, planning::HashSet>>& el);
+
 template<typename Task>
 std::ostream& print(std::ostream& os, const planning::StateView<Task>& el)
 {
@@ -179,16 +186,23 @@ std::ostream& operator<<(std::ostream& os, const LiftedTask& el) { return tyr::p
 
 std::ostream& operator<<(std::ostream& os, const GroundTask& el) { return tyr::print(os, el); }
 
-std::ostream& operator<<(std::ostream& os, const Data<State<LiftedTask>>& el) { return tyr::print(os, el); }
-
 std::ostream& operator<<(std::ostream& os, const UnpackedState<LiftedTask>& el) { return tyr::print(os, el); }
 
-std::ostream& operator<<(std::ostream& os, const Data<State<GroundTask>>& el) { return tyr::print(os, el); }
-
 std::ostream& operator<<(std::ostream& os, const UnpackedState<GroundTask>& el) { return tyr::print(os, el); }
 
 std::ostream& operator<<(std::ostream& os, const Statistics& el) { return tyr::print(os, el); }
 
+template<typename Task, typename Tag>
+std::ostream& operator<<(std::ostream& os, const Data<PackedState<Task, Tag>>& el)
+{
+    return tyr::print(os, el);
+}
+
+template std::ostream& operator<<(std::ostream& os, const Data<PackedState<LiftedTask, TreeCompression>>& el);
+template std::ostream& operator<<(std::ostream& os, const Data<PackedState<LiftedTask, HashSet>>& el);
+template std::ostream& operator<<(std::ostream& os, const Data<PackedState<GroundTask, TreeCompression>>& el);
+template std::ostream& operator<<(std::ostream& os, const Data<PackedState<GroundTask, HashSet>>& el);
+
 template<typename Task>
 std::ostream& operator<<(std::ostream& os, const StateView<Task>& el)
 {
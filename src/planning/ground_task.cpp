@@ -18,6 +18,7 @@
 #include "tyr/planning/ground_task.hpp"
 
 #include "tyr/common/comparators.hpp"                         // for operat...
+#include "tyr/common/memory_usage.hpp"                        // for get_me...
 #include "tyr/common/dynamic_bitset.hpp"                      // for set
 #include "tyr/common/vector.hpp"                              // for View, set
 #include "tyr/formalism/planning/fdr_context.hpp"             // for Genera...
@@ -65,4 +66,17 @@ template size_t GroundTask::get_num_atoms<f::DerivedTag>() const noexcept;
 size_t GroundTask::get_num_actions() const noexcept { return get_task().get_ground_actions().size(); }
 
 size_t GroundTask::get_num_axioms() const noexcept { return get_task().get_ground_axioms().size(); }
+
+size_t GroundTask::memory_usage() const noexcept
+{
+    auto bytes = get_repository()->memory_usage() + get_memory_usage(m_static_atoms_bitset) + get_memory_usage(m_static_numeric_variables);
+
+    if (m_action_match_tree)
+        bytes += m_action_match_tree->memory_usage();
+
+    for (const auto& match_tree : m_axiom_match_tree_strata)
+        bytes += match_tree->memory_usage();
+
+    return bytes;
+}
 }
@@ -0,0 +1,362 @@
+/*
+ * Copyright (C) 2025 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "tyr/buffer/declarations.hpp"
+#include "tyr/common/config.hpp"
+#include "tyr/common/mapped_file.hpp"
+#include "tyr/common/types.hpp"
+#include "tyr/formalism/planning/fdr_context.hpp"
+#include "tyr/formalism/planning/repository.hpp"
+#include "tyr/formalism/planning/views.hpp"
+#include "tyr/planning/ground_task.hpp"
+
+#include <cista/serialization.h>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace f = tyr::formalism;
+namespace fp = tyr::formalism::planning;
+
+namespace tyr::planning
+{
+namespace
+{
+constexpr char SNAPSHOT_MAGIC[8] = { 'T', 'Y', 'R', 'G', 'T', 'S', 'K', '\0' };
+constexpr uint32_t SNAPSHOT_VERSION = 1;
+constexpr size_t SNAPSHOT_ALIGNMENT = alignof(std::max_align_t);
+
+/// @brief Fixed-size header at the beginning of every snapshot file.
+struct SnapshotHeader
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t index_size;
+    uint64_t num_symbol_tags;
+    uint64_t num_relation_tags;
+    uint64_t domain;
+    uint64_t task;
+};
+
+template<typename Repo>
+struct RepositoryTags;
+
+template<typename... Ts>
+struct RepositoryTags<f::SymbolRepository<Ts...>>
+{
+    static constexpr size_t size = sizeof...(Ts);
+
+    template<typename F>
+    static void for_each(F&& callback)
+    {
+        (callback(std::type_identity<Ts> {}), ...);
+    }
+};
+
+template<typename... Ts>
+struct RepositoryTags<f::RelationRepository<Ts...>>
+{
+    static constexpr size_t size = sizeof...(Ts);
+
+    template<typename F>
+    static void for_each(F&& callback)
+    {
+        (callback(std::type_identity<Ts> {}), ...);
+    }
+};
+
+using SymbolTags = RepositoryTags<fp::SymbolRepository>;
+using RelationTags = RepositoryTags<fp::RelationRepository>;
+
+class SnapshotWriter
+{
+public:
+    explicit SnapshotWriter(const std::filesystem::path& filepath) : m_out(filepath, std::ios::binary | std::ios::trunc), m_pos(0)
+    {
+        if (!m_out)
+            throw std::runtime_error("GroundTask::save(...): Failed to open " + filepath.string() + " for writing.");
+    }
+
+    void write(const void* data, size_t amount)
+    {
+        m_out.write(reinterpret_cast<const char*>(data), static_cast<std::streamsize>(amount));
+        m_pos += amount;
+    }
+
+    template<typename T>
+        requires std::is_trivially_copyable_v<T>
+    void write_value(const T& value)
+    {
+        write(&value, sizeof(T));
+    }
+
+    void align(size_t alignment)
+    {
+        static constexpr char zeros[SNAPSHOT_ALIGNMENT] = {};
+
+        const auto padding = (alignment - m_pos % alignment) % alignment;
+        write(zeros, padding);
+    }
+
+    void finish()
+    {
+        m_out.flush();
+        if (!m_out)
+            throw std::runtime_error("GroundTask::save(...): Failed to write the snapshot.");
+    }
+
+private:
+    std::ofstream m_out;
+    size_t m_pos;
+};
+
+class SnapshotReader
+{
+public:
+    explicit SnapshotReader(const MappedFile& file) : m_data(file.data()), m_size(file.size()), m_pos(0) {}
+
+    const uint8_t* read(size_t amount, size_t alignment = 1)
+    {
+        m_pos += (alignment - m_pos % alignment) % alignment;
+
+        if (m_pos + amount > m_size)
+            throw std::runtime_error("GroundTask::load_mmap(...): Unexpected end of snapshot.");
+
+        const auto* data = m_data + m_pos;
+        m_pos += amount;
+        return data;
+    }
+
+    template<typename T>
+        requires std::is_trivially_copyable_v<T>
+    T read_value()
+    {
+        auto value = T();
+        std::memcpy(&value, read(sizeof(T)), sizeof(T));
+        return value;
+    }
+
+    bool at_end() const noexcept { return m_pos == m_size; }
+
+private:
+    const uint8_t* m_data;
+    size_t m_size;
+    size_t m_pos;
+};
+
+void write_symbols(const fp::Repository& repository, SnapshotWriter& out)
+{
+    auto buf = buffer::Buffer();
+
+    SymbolTags::for_each(
+        [&](auto tag)
+        {
+            using T = typename decltype(tag)::type;
+
+            // Iterating over the global indices flattens the parent repositories into the snapshot.
+            const auto size = repository.template size<T>();
+            out.write_value(uint64_t(size));
+
+            for (uint_t i = 0; i < size; ++i)
+            {
+                const auto& element = repository[Index<T>(i)];
+
+                if constexpr (uses_trivial_storage_v<T>)
+                {
+                    out.align(alignof(Data<T>));
+                    out.write(&element, sizeof(Data<T>));
+                }
+                else
+                {
+                    buf.reset();
+                    ::cista::serialize<CISTA_MODE>(buf, element);
+
+                    out.write_value(uint64_t(buf.size()));
+                    out.align(SNAPSHOT_ALIGNMENT);
+                    out.write(buf.base(), buf.size());
+                }
+            }
+        });
+}
+
+void read_symbols(fp::Repository& repository, SnapshotReader& in)
+{
+    SymbolTags::for_each(
+        [&](auto tag)
+        {
+            using T = typename decltype(tag)::type;
+
+            const auto size = in.read_value<uint64_t>();
+
+            for (uint64_t i = 0; i < size; ++i)
+            {
+                bool success = false;
+
+                if constexpr (uses_trivial_storage_v<T>)
+                {
+                    auto element = Data<T>();
+                    std::memcpy(&element, in.read(sizeof(Data<T>), alignof(Data<T>)), sizeof(Data<T>));
+                    success = repository.insert_external(element).second;
+                }
+                else
+                {
+                    const auto num_bytes = in.read_value<uint64_t>();
+                    const auto* begin = in.read(num_bytes, SNAPSHOT_ALIGNMENT);
+                    success = repository.insert_external(*::cista::deserialize<const Data<T>, CISTA_MODE>(begin, begin + num_bytes)).second;
+                }
+
+                if (!success)
+                    throw std::runtime_error("GroundTask::load_mmap(...): Snapshot contains duplicate elements.");
+            }
+        });
+}
+
+void write_relations(const fp::Repository& repository, SnapshotWriter& out)
+{
+    RelationTags::for_each(
+        [&](auto tag)
+        {
+            using T = typename decltype(tag)::type;
+
+            const auto num_relations = repository.template size<T>();
+            out.write_value(uint64_t(num_relations));
+
+            for (uint_t g = 0; g < num_relations; ++g)
+            {
+                const auto relation = Index<T>(g);
+                const auto num_rows = repository.size(relation);
+                out.write_value(uint64_t(num_rows));
+
+                for (uint_t row = 0; row < num_rows; ++row)
+                {
+                    const auto binding = make_view(Index<f::RelationBinding<T>> { relation, Index<f::Row>(row) }, repository);
+
+                    auto objects = IndexList<f::Object> {};
+                    for (const auto object : binding.get_objects())
+                        objects.push_back(object.get_index());
+
+                    out.write_value(uint64_t(objects.size()));
+                    for (const auto object : objects)
+                        out.write_value(uint_t(object));
+                }
+            }
+        });
+}
+
+void read_relations(fp::Repository& repository, SnapshotReader& in)
+{
+    RelationTags::for_each(
+        [&](auto tag)
+        {
+            using T = typename decltype(tag)::type;
+
+            auto binding = Data<f::RelationBinding<T>>();
+
+            const auto num_relations = in.read_value<uint64_t>();
+
+            for (uint64_t g = 0; g < num_relations; ++g)
+            {
+                const auto num_rows = in.read_value<uint64_t>();
+
+                for (uint64_t row = 0; row < num_rows; ++row)
+                {
+                    binding.clear();
+                    binding.relation = Index<T>(static_cast<uint_t>(g));
+
+                    const auto arity = in.read_value<uint64_t>();
+                    for (uint64_t i = 0; i < arity; ++i)
+                        binding.objects.push_back(Index<f::Object>(in.read_value<uint_t>()));
+
+                    if (!repository.get_or_create(binding).second)
+                        throw std::runtime_error("GroundTask::load_mmap(...): Snapshot contains duplicate bindings.");
+                }
+            }
+        });
+}
+}
+
+void GroundTask::save(const std::filesystem::path& filepath) const
+{
+    const auto& repository = *get_repository();
+
+    auto header = SnapshotHeader();
+    std::memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC));
+    header.version = SNAPSHOT_VERSION;
+    header.index_size = sizeof(uint_t);
+    header.num_symbol_tags = SymbolTags::size;
+    header.num_relation_tags = RelationTags::size;
+    header.domain = uint_t(get_domain().get_domain().get_index());
+    header.task = uint_t(get_task().get_index());
+
+    auto out = SnapshotWriter(filepath);
+    out.write_value(header);
+
+    write_symbols(repository, out);
+    write_relations(repository, out);
+
+    out.finish();
+}
+
+GroundTaskPtr GroundTask::load_mmap(const std::filesystem::path& filepath)
+{
+    auto file = MappedFile::create(filepath);
+    auto in = SnapshotReader(*file);
+
+    const auto header = in.read_value<SnapshotHeader>();
+    if (std::memcmp(header.magic, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC)) != 0)
+        throw std::runtime_error("GroundTask::load_mmap(...): " + filepath.string() + " is not a ground task snapshot.");
+    if (header.version != SNAPSHOT_VERSION)
+        throw std::runtime_error("GroundTask::load_mmap(...): Expected snapshot version " + std::to_string(SNAPSHOT_VERSION) + " but got "
+                                 + std::to_string(header.version) + ".");
+    if (header.index_size != sizeof(uint_t) || header.num_symbol_tags != SymbolTags::size || header.num_relation_tags != RelationTags::size)
+        throw std::runtime_error("GroundTask::load_mmap(...): Snapshot was written by an incompatible build.");
+
+    // Non-trivial elements are referenced in place, so the mapping must outlive the repository.
+    auto factory = std::make_shared<fp::RepositoryFactory>();
+    auto repository = fp::RepositoryPtr(new fp::Repository(factory->create()), [file](fp::Repository* ptr) { delete ptr; });
+
+    read_symbols(*repository, in);
+    read_relations(*repository, in);
+
+    if (!in.at_end())
+        throw std::runtime_error("GroundTask::load_mmap(...): Snapshot contains trailing data.");
+    if (header.domain >= repository->template size<fp::Domain>() || header.task >= repository->template size<fp::FDRTask>())
+        throw std::runtime_error("GroundTask::load_mmap(...): Snapshot refers to missing domain or task.");
+
+    const auto domain = make_view(Index<fp::Domain>(static_cast<uint_t>(header.domain)), *repository);
+    const auto task = make_view(Index<fp::FDRTask>(static_cast<uint_t>(header.task)), *repository);
+
+    /// --- Restore the FDR context from the variables of the task
+
+    auto mutex_groups = std::vector<std::vector<fp::GroundAtomView<f::FluentTag>>> {};
+    for (const auto variable : task.get_fluent_variables())
+    {
+        auto group = std::vector<fp::GroundAtomView<f::FluentTag>> {};
+        for (const auto atom : variable.get_atoms())
+            group.push_back(atom);
+        mutex_groups.push_back(std::move(group));
+    }
+    auto fdr_context = std::make_shared<fp::FDRContext>(mutex_groups, repository);
+
+    return std::make_shared<GroundTask>(fp::PlanningFDRTask(task, std::move(fdr_context), repository, fp::PlanningDomain(domain, repository, factory)));
+}
+
+}
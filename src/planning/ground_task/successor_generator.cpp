@@ -18,6 +18,8 @@
 #include "tyr/planning/ground_task/successor_generator.hpp"
 
 #include "../metric.hpp"
+#include "tyr/common/perf_counters.hpp"
+#include "tyr/common/trace.hpp"
 #include "tyr/formalism/planning/repository.hpp"
 #include "tyr/formalism/planning/views.hpp"  // for View
 #include "tyr/planning/applicability.hpp"    // for StateC...
@@ -34,17 +36,21 @@ namespace fp = tyr::formalism::planning;
 namespace tyr::planning
 {
 
-SuccessorGenerator<GroundTask>::SuccessorGenerator(std::shared_ptr<GroundTask> task, ExecutionContextPtr execution_context) :
+SuccessorGenerator<GroundTask>::SuccessorGenerator(std::shared_ptr<GroundTask> task,
+                                                   ExecutionContextPtr execution_context,
+                                                   StateStoragePolicy storage_policy) :
     m_task(task),
     m_applicable_actions(),
-    m_state_repository(std::make_shared<StateRepository<GroundTask>>(task, execution_context)),
+    m_state_repository(std::make_shared<StateRepository<GroundTask>>(task, execution_context, storage_policy)),
     m_executor()
 {
 }
 
-std::shared_ptr<SuccessorGenerator<GroundTask>> SuccessorGenerator<GroundTask>::create(std::shared_ptr<GroundTask> task, ExecutionContextPtr execution_context)
+std::shared_ptr<SuccessorGenerator<GroundTask>> SuccessorGenerator<GroundTask>::create(std::shared_ptr<GroundTask> task,
+                                                                                       ExecutionContextPtr execution_context,
+                                                                                       StateStoragePolicy storage_policy)
 {
-    return std::make_shared<SuccessorGenerator<GroundTask>>(std::move(task), std::move(execution_context));
+    return std::make_shared<SuccessorGenerator<GroundTask>>(std::move(task), std::move(execution_context), storage_policy);
 }
 
 Node<GroundTask> SuccessorGenerator<GroundTask>::get_initial_node()
@@ -69,6 +75,9 @@ std::vector<LabeledNode<GroundTask>> SuccessorGenerator<GroundTask>::get_labeled
 
 void SuccessorGenerator<GroundTask>::get_labeled_successor_nodes(const Node<GroundTask>& node, std::vector<LabeledNode<GroundTask>>& out_nodes)
 {
+    const auto successor_trace = trace::TraceScope("generate_successors", "search");
+    const auto successor_counters = PerfCounterScope(m_perf_counters);
+
     out_nodes.clear();
 
     const auto state = node.get_state();
@@ -84,6 +93,26 @@ void SuccessorGenerator<GroundTask>::get_labeled_successor_nodes(const Node<Grou
     }
 }
 
+void SuccessorGenerator<GroundTask>::get_applicable_actions(const Node<GroundTask>& node, fp::GroundActionViewList& out_actions)
+{
+    const auto successor_trace = trace::TraceScope("generate_applicable_actions", "search");
+    const auto successor_counters = PerfCounterScope(m_perf_counters);
+
+    out_actions.clear();
+
+    const auto state = node.get_state();
+
+    const auto state_context = StateContext<GroundTask>(*m_task, state.get_unpacked_state(), node.get_metric());
+
+    m_task->get_action_match_tree()->generate(state_context, m_applicable_actions);
+
+    for (const auto ground_action : make_view(m_applicable_actions, *m_task->get_repository()))
+    {
+        if (m_executor.is_applicable(ground_action, state_context))
+            out_actions.push_back(ground_action);
+    }
+}
+
 Node<GroundTask> SuccessorGenerator<GroundTask>::get_successor_node(const Node<GroundTask>& node, fp::GroundActionView action)
 {
     const auto& state = node.get_state();
@@ -101,6 +130,11 @@ Node<GroundTask> SuccessorGenerator<GroundTask>::get_node(Index<State<GroundTask
     return Node<GroundTask>(std::move(state), state_metric);
 }
 
+size_t SuccessorGenerator<GroundTask>::memory_usage() const noexcept
+{
+    return m_state_repository->memory_usage() + m_applicable_actions.capacity() * sizeof(Index<fp::GroundAction>);
+}
+
 static_assert(SuccessorGeneratorConcept<SuccessorGenerator<GroundTask>, GroundTask>);
 
 }
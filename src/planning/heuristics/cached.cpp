@@ -0,0 +1,131 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "tyr/planning/heuristics/cached.hpp"
+
+#include "tyr/planning/ground_task.hpp"
+#include "tyr/planning/lifted_task.hpp"
+
+#include <cmath>
+
+namespace tyr::planning
+{
+
+template<typename Task>
+CachedHeuristic<Task>::CachedHeuristic(std::shared_ptr<const Task> task, HeuristicPtr<Task> heuristic) :
+    m_task(std::move(task)),
+    m_heuristic(std::move(heuristic)),
+    m_entries(),
+    m_preferred_actions_storage(),
+    m_preferred_actions(),
+    m_preferred_action_views(),
+    m_preferred_action_views_dirty(false),
+    m_num_hits(0),
+    m_num_misses(0)
+{
+}
+
+template<typename Task>
+std::shared_ptr<CachedHeuristic<Task>> CachedHeuristic<Task>::create(std::shared_ptr<const Task> task, HeuristicPtr<Task> heuristic)
+{
+    return std::make_shared<CachedHeuristic<Task>>(std::move(task), std::move(heuristic));
+}
+
+template<typename Task>
+void CachedHeuristic<Task>::set_goal(formalism::planning::GroundConjunctiveConditionView goal)
+{
+    m_heuristic->set_goal(goal);
+
+    clear();
+}
+
+template<typename Task>
+float_t CachedHeuristic<Task>::evaluate(const StateView<Task>& state)
+{
+    const auto state_index = uint_t(state.get_index());
+
+    while (state_index >= m_entries.size())
+        m_entries.push_back(UNCACHED_ENTRY);
+
+    auto& entry = m_entries[state_index];
+
+    m_preferred_actions.clear();
+    m_preferred_action_views_dirty = true;
+
+    if (!std::isnan(entry.h_value))
+    {
+        ++m_num_hits;
+
+        for (auto i = entry.preferred_actions_begin; i < entry.preferred_actions_end; ++i)
+            m_preferred_actions.insert(m_preferred_actions_storage[i]);
+
+        return entry.h_value;
+    }
+
+    ++m_num_misses;
+
+    const auto h_value = m_heuristic->evaluate(state);
+
+    entry.h_value = h_value;
+    entry.preferred_actions_begin = m_preferred_actions_storage.size();
+    for (const auto action_index : m_heuristic->get_preferred_actions())
+    {
+        m_preferred_actions_storage.push_back(action_index);
+        m_preferred_actions.insert(action_index);
+    }
+    entry.preferred_actions_end = m_preferred_actions_storage.size();
+
+    return h_value;
+}
+
+template<typename Task>
+const UnorderedSet<Index<formalism::planning::GroundAction>>& CachedHeuristic<Task>::get_preferred_actions()
+{
+    return m_preferred_actions;
+}
+
+template<typename Task>
+const UnorderedSet<formalism::planning::GroundActionView>& CachedHeuristic<Task>::get_preferred_action_views()
+{
+    if (m_preferred_action_views_dirty)
+    {
+        m_preferred_action_views_dirty = false;
+        m_preferred_action_views.clear();
+        const auto& repository = *m_task->get_repository();
+        for (const auto action_index : m_preferred_actions)
+            m_preferred_action_views.insert(make_view(action_index, repository));
+    }
+
+    return m_preferred_action_views;
+}
+
+template<typename Task>
+void CachedHeuristic<Task>::clear()
+{
+    m_entries.clear();
+    m_preferred_actions_storage.clear();
+    m_preferred_actions.clear();
+    m_preferred_action_views.clear();
+    m_preferred_action_views_dirty = false;
+    m_num_hits = 0;
+    m_num_misses = 0;
+}
+
+template class CachedHeuristic<LiftedTask>;
+template class CachedHeuristic<GroundTask>;
+
+}
@@ -24,6 +24,35 @@
 namespace tyr::planning
 {
 
+template<typename Task>
+float_t count_unsatisfied_goals(formalism::planning::GroundConjunctiveConditionView goal, const StateContext<Task>& context)
+{
+    auto unsat_counter = float_t { 0 };
+
+    for (const auto fact : goal.template get_facts<formalism::FluentTag>())
+    {
+        if (!is_applicable(fact, context))
+            ++unsat_counter;
+    }
+
+    for (const auto fact : goal.template get_facts<formalism::DerivedTag>())
+    {
+        if (!is_applicable(fact, context))
+            ++unsat_counter;
+    }
+
+    for (const auto numeric_constraint : goal.get_numeric_constraints())
+    {
+        if (!is_applicable(numeric_constraint, context))
+            ++unsat_counter;
+    }
+
+    return unsat_counter;
+}
+
+template float_t count_unsatisfied_goals(formalism::planning::GroundConjunctiveConditionView goal, const StateContext<LiftedTask>& context);
+template float_t count_unsatisfied_goals(formalism::planning::GroundConjunctiveConditionView goal, const StateContext<GroundTask>& context);
+
 template<typename Task>
 GoalCountHeuristic<Task>::GoalCountHeuristic(std::shared_ptr<const Task> task) : m_task(std::move(task)), m_goal(m_task->get_task().get_goal())
 {
@@ -44,29 +73,7 @@ void GoalCountHeuristic<Task>::set_goal(formalism::planning::GroundConjunctiveCo
 template<typename Task>
 float_t GoalCountHeuristic<Task>::evaluate(const StateView<Task>& state)
 {
-    auto unsat_counter = float_t { 0 };
-
-    auto state_context = StateContext<Task> { *m_task, state.get_unpacked_state(), float_t { 0 } };
-
-    for (const auto fact : m_goal.template get_facts<formalism::FluentTag>())
-    {
-        if (!is_applicable(fact, state_context))
-            ++unsat_counter;
-    }
-
-    for (const auto fact : m_goal.template get_facts<formalism::DerivedTag>())
-    {
-        if (!is_applicable(fact, state_context))
-            ++unsat_counter;
-    }
-
-    for (const auto numeric_constraint : m_goal.get_numeric_constraints())
-    {
-        if (!is_applicable(numeric_constraint, state_context))
-            ++unsat_counter;
-    }
-
-    return unsat_counter;
+    return count_unsatisfied_goals(m_goal, StateContext<Task> { *m_task, state.get_unpacked_state(), float_t { 0 } });
 }
 
 template class GoalCountHeuristic<LiftedTask>;
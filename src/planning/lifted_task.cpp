@@ -88,4 +88,10 @@ std::shared_ptr<LiftedTask> LiftedTask::create(formalism::planning::PlanningTask
 
 GroundTaskPtr LiftedTask::instantiate_ground_task(ExecutionContext& execution_context) { return ground_task(*this, execution_context); }
 
+size_t LiftedTask::memory_usage() const noexcept
+{
+    return get_repository()->memory_usage() + m_axiom_program.get_const_program_workspace().memory_usage()
+           + m_action_program.get_const_program_workspace().memory_usage() + m_rpg_program.get_const_program_workspace().memory_usage();
+}
+
 }
@@ -49,6 +49,7 @@ namespace tyr::planning
 
 static void insert_unextended_state(const UnpackedState<LiftedTask>& unpacked_state,
                                     const fp::Repository& atoms_context,
+                                    AtomTranslationTable& atom_translation_table,
                                     fp::MergeDatalogContext& merge_context,
                                     d::TaggedFactSets<f::FluentTag>& fact_sets,
                                     d::TaggedAssignmentSets<f::FluentTag>& assignment_sets)
@@ -56,12 +57,12 @@ static void insert_unextended_state(const UnpackedState<LiftedTask>& unpacked_st
     fact_sets.reset();
     assignment_sets.reset();
 
-    insert_fluent_atoms_to_fact_set(unpacked_state, atoms_context, merge_context, fact_sets);
+    insert_fluent_atoms_to_fact_set(unpacked_state, atoms_context, atom_translation_table, merge_context, fact_sets);
 
     assignment_sets.insert(fact_sets);
 }
 
-static void read_derived_atoms_from_program_context(const AxiomEvaluatorProgram& axiom_program,
+static void read_derived_atoms_from_program_context(AxiomEvaluatorProgram& axiom_program,
                                                     UnpackedState<LiftedTask>& unpacked_state,
                                                     fp::MergePlanningContext& merge_context,
                                                     d::TaggedFactSets<f::FluentTag>& fact_sets)
@@ -72,7 +73,7 @@ static void read_derived_atoms_from_program_context(const AxiomEvaluatorProgram&
         {
             if (axiom_program.get_predicate_to_predicate_mapping().contains(binding.get_relation()))
             {
-                const auto ground_atom = fp::merge_atom_d2p<f::FluentTag, f::DerivedTag>(binding, merge_context).first.get_index();
+                const auto ground_atom = axiom_program.get_atom_translation_table().to_planning(binding, merge_context).get_index();
 
                 unpacked_state.set(ground_atom);
             }
@@ -100,7 +101,12 @@ void AxiomEvaluator<LiftedTask>::compute_extended_state(UnpackedState<LiftedTask
 {
     auto merge_datalog_context = fp::MergeDatalogContext { m_workspace.datalog_builder, m_workspace.workspace_repository };
 
-    insert_unextended_state(unpacked_state, *m_task->get_repository(), merge_datalog_context, m_workspace.facts.fact_sets, m_workspace.facts.assignment_sets);
+    insert_unextended_state(unpacked_state,
+                            *m_task->get_repository(),
+                            m_task->get_axiom_program().get_atom_translation_table(),
+                            merge_datalog_context,
+                            m_workspace.facts.fact_sets,
+                            m_workspace.facts.assignment_sets);
 
     auto ctx = d::ProgramExecutionContext(m_workspace, m_task->get_axiom_program().get_const_program_workspace());
     ctx.clear();
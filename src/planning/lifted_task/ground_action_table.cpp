@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 2025 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "tyr/planning/lifted_task/ground_action_table.hpp"
+
+#include "tyr/common/memory_usage.hpp"
+#include "tyr/formalism/planning/grounder.hpp"
+#include "tyr/planning/lifted_task.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace f = tyr::formalism;
+namespace fp = tyr::formalism::planning;
+
+namespace tyr::planning
+{
+
+GroundActionTable::GroundActionTable(LiftedTask& task) :
+    m_task(&task),
+    m_radix(std::max<uint64_t>(task.get_repository()->size<f::Object>(), 1)),
+    m_max_arity(0),
+    m_tables(),
+    m_num_hits(0),
+    m_num_misses(0)
+{
+    // Find the largest k with m_radix^k <= 2^64 - 1. A single object admits bindings of any length.
+    if (m_radix == 1)
+        m_max_arity = std::numeric_limits<size_t>::max();
+    else
+        for (auto capacity = std::numeric_limits<uint64_t>::max(); capacity >= m_radix; capacity /= m_radix)
+            ++m_max_arity;
+}
+
+std::optional<uint64_t> GroundActionTable::encode(const IndexList<f::Object>& binding) const noexcept
+{
+    if (binding.size() > m_max_arity)
+        return std::nullopt;
+
+    auto key = uint64_t(0);
+    for (const auto object : binding)
+    {
+        // Objects created after the table are not covered by the radix.
+        if (uint_t(object) >= m_radix)
+            return std::nullopt;
+        key = key * m_radix + uint_t(object);
+    }
+    return key;
+}
+
+fp::GroundActionView GroundActionTable::get_or_create(fp::ActionView action,
+                                                      fp::GrounderContext& context,
+                                                      UnorderedMap<Index<fp::FDRVariable<f::FluentTag>>, fp::FDRValue>& assign,
+                                                      itertools::cartesian_set::Workspace<Index<f::Object>>& iter_workspace)
+{
+    const auto action_index = uint_t(action.get_index());
+    const auto key = encode(context.binding);
+
+    if (key)
+    {
+        if (action_index >= m_tables.size())
+            m_tables.resize(action_index + 1);
+
+        const auto& table = m_tables[action_index];
+        if (const auto it = table.find(*key); it != table.end())
+        {
+            ++m_num_hits;
+            return make_view(it->second, context.destination);
+        }
+    }
+
+    ++m_num_misses;
+
+    const auto& cond_effect_domains = m_task->get_parameter_domains_per_cond_effect_per_action()[action_index];
+    const auto ground_action = fp::ground(action, context, cond_effect_domains, assign, iter_workspace, *m_task->get_fdr_context()).first;
+
+    if (key)
+        m_tables[action_index].emplace(*key, ground_action.get_index());
+
+    return ground_action;
+}
+
+void GroundActionTable::clear() noexcept
+{
+    m_tables.clear();
+    m_num_hits = 0;
+    m_num_misses = 0;
+}
+
+size_t GroundActionTable::size() const noexcept
+{
+    size_t result = 0;
+    for (const auto& table : m_tables)
+        result += table.size();
+    return result;
+}
+
+size_t GroundActionTable::memory_usage() const noexcept { return get_memory_usage(m_tables); }
+
+}
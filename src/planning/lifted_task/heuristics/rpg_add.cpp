@@ -19,7 +19,7 @@
 
 namespace tyr::planning
 {
-AddRPGHeuristic<LiftedTask>::AddRPGHeuristic(std::shared_ptr<LiftedTask> task, ExecutionContextPtr execution_context) :
+AddRPGHeuristic<LiftedTask>::AddRPGHeuristic(std::shared_ptr<LiftedTask> task, ExecutionContextPtr execution_context, bool use_action_costs) :
     RPGBase<AddRPGHeuristic<LiftedTask>,
             datalog::OrAnnotationPolicy,
             datalog::AndAnnotationPolicy<datalog::SumAggregation>,
@@ -27,20 +27,23 @@ AddRPGHeuristic<LiftedTask>::AddRPGHeuristic(std::shared_ptr<LiftedTask> task, E
         task,
         std::move(execution_context),
         datalog::OrAnnotationPolicy(),
-        datalog::AndAnnotationPolicy<datalog::SumAggregation>(),
+        use_action_costs ? datalog::AndAnnotationPolicy<datalog::SumAggregation>(task->get_rpg_program().get_scaled_rule_action_costs()) :
+                           datalog::AndAnnotationPolicy<datalog::SumAggregation>(),
         datalog::TerminationPolicy<datalog::SumAggregation>(
-            task->get_rpg_program().get_program_context().get_program().get_predicates<formalism::FluentTag>().size()))
+            task->get_rpg_program().get_program_context().get_program().get_predicates<formalism::FluentTag>().size())),
+    m_action_cost_scale(use_action_costs ? task->get_rpg_program().get_action_cost_scale() : float_t(1))
 {
 }
 
-std::shared_ptr<AddRPGHeuristic<LiftedTask>> AddRPGHeuristic<LiftedTask>::create(std::shared_ptr<LiftedTask> task, ExecutionContextPtr execution_context)
+std::shared_ptr<AddRPGHeuristic<LiftedTask>>
+AddRPGHeuristic<LiftedTask>::create(std::shared_ptr<LiftedTask> task, ExecutionContextPtr execution_context, bool use_action_costs)
 {
-    return std::make_shared<AddRPGHeuristic<LiftedTask>>(std::move(task), std::move(execution_context));
+    return std::make_shared<AddRPGHeuristic<LiftedTask>>(std::move(task), std::move(execution_context), use_action_costs);
 }
 
 float_t AddRPGHeuristic<LiftedTask>::extract_cost_and_set_preferred_actions_impl(const StateView<LiftedTask>& state)
 {
-    return m_workspace.tp.get_total_cost(this->m_workspace.or_annot);
+    return m_workspace.tp.get_total_cost(this->m_workspace.or_annot) / m_action_cost_scale;
 }
 
 }
@@ -33,7 +33,7 @@
 namespace tyr::planning
 {
 
-FFRPGHeuristic<LiftedTask>::FFRPGHeuristic(std::shared_ptr<LiftedTask> task, ExecutionContextPtr execution_context) :
+FFRPGHeuristic<LiftedTask>::FFRPGHeuristic(std::shared_ptr<LiftedTask> task, ExecutionContextPtr execution_context, bool use_action_costs) :
     RPGBase<FFRPGHeuristic<LiftedTask>,
             datalog::OrAnnotationPolicy,
             datalog::AndAnnotationPolicy<datalog::SumAggregation>,
@@ -41,30 +41,36 @@ FFRPGHeuristic<LiftedTask>::FFRPGHeuristic(std::shared_ptr<LiftedTask> task, Exe
         task,
         std::move(execution_context),
         datalog::OrAnnotationPolicy(),
-        datalog::AndAnnotationPolicy<datalog::SumAggregation>(),
+        use_action_costs ? datalog::AndAnnotationPolicy<datalog::SumAggregation>(task->get_rpg_program().get_scaled_rule_action_costs()) :
+                           datalog::AndAnnotationPolicy<datalog::SumAggregation>(),
         datalog::TerminationPolicy<datalog::SumAggregation>(
             task->get_rpg_program().get_program_context().get_program().get_predicates<formalism::FluentTag>().size())),
+    m_use_action_costs(use_action_costs),
     m_markings(task->get_rpg_program().get_program_context().get_program().get_predicates<formalism::FluentTag>().size()),
     m_binding(),
     m_assign(),
     m_iter_workspace(),
+    m_ground_action_table(*task),
     m_effect_families(),
     m_relaxed_plan(),
+    m_relaxed_plan_cost(0),
     m_preferred_actions(),
     m_preferred_action_views(),
     m_preferred_action_views_dirty(true)
 {
 }
 
-std::shared_ptr<FFRPGHeuristic<LiftedTask>> FFRPGHeuristic<LiftedTask>::create(std::shared_ptr<LiftedTask> task, ExecutionContextPtr execution_context)
+std::shared_ptr<FFRPGHeuristic<LiftedTask>>
+FFRPGHeuristic<LiftedTask>::create(std::shared_ptr<LiftedTask> task, ExecutionContextPtr execution_context, bool use_action_costs)
 {
-    return std::make_shared<FFRPGHeuristic<LiftedTask>>(std::move(task), std::move(execution_context));
+    return std::make_shared<FFRPGHeuristic<LiftedTask>>(std::move(task), std::move(execution_context), use_action_costs);
 }
 
 float_t FFRPGHeuristic<LiftedTask>::extract_cost_and_set_preferred_actions_impl(const StateView<LiftedTask>& state)
 {
     m_preferred_action_views_dirty = true;
     m_relaxed_plan.clear();
+    m_relaxed_plan_cost = 0;
     m_preferred_actions.clear();
     for (auto& bitset : m_markings)
         bitset.reset();
@@ -75,7 +81,7 @@ float_t FFRPGHeuristic<LiftedTask>::extract_cost_and_set_preferred_actions_impl(
     for (const auto atom : m_workspace.tp.get_bindings())
         extract_relaxed_plan_and_preferred_actions(atom, state_context, grounder_context);
 
-    return m_relaxed_plan.size();
+    return m_use_action_costs ? m_relaxed_plan_cost : float_t(m_relaxed_plan.size());
 }
 
 const UnorderedSet<Index<formalism::planning::GroundAction>>& FFRPGHeuristic<LiftedTask>::get_preferred_actions() { return m_preferred_actions; }
@@ -134,17 +140,12 @@ void FFRPGHeuristic<LiftedTask>::extract_relaxed_plan_and_preferred_actions(form
         for (const auto object : row)
             grounder_context.binding.push_back(object.get_index());
 
-        const auto ground_action = formalism::planning::ground(action,
-                                                               grounder_context,
-                                                               m_task->get_parameter_domains_per_cond_effect_per_action()[uint_t(action.get_index())],
-                                                               m_assign,
-                                                               m_iter_workspace,
-                                                               *m_task->get_fdr_context())
-                                       .first;
+        const auto ground_action = m_ground_action_table.get_or_create(action, grounder_context, m_assign, m_iter_workspace);
 
         const auto ground_action_index = ground_action.get_index();
 
-        m_relaxed_plan.insert(ground_action_index);
+        if (m_relaxed_plan.insert(ground_action_index).second && m_use_action_costs)
+            m_relaxed_plan_cost += tyr::get(uint_t(rule.get_index()), this->m_task->get_rpg_program().get_rule_action_costs(), float_t(0));
 
         if (is_applicable(ground_action, state_context, m_effect_families))
             m_preferred_actions.insert(ground_action_index);
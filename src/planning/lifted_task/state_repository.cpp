@@ -18,6 +18,8 @@
 #include "tyr/planning/lifted_task/state_repository.hpp"
 
 #include "tyr/common/comparators.hpp"  // for operat...
+#include "tyr/common/perf_counters.hpp"
+#include "tyr/common/trace.hpp"
 #include "tyr/common/vector.hpp"       // for View
 #include "tyr/formalism/planning/declarations.hpp"
 #include "tyr/formalism/planning/fdr_context.hpp"  // for Binary...
@@ -29,6 +31,7 @@
 
 #include <tuple>           // for operat...
 #include <utility>         // for move
+#include <variant>         // for visit
 #include <valla/slot.hpp>  // for Slot
 
 namespace f = tyr::formalism;
@@ -37,20 +40,20 @@ namespace fp = tyr::formalism::planning;
 namespace tyr::planning
 {
 
-StateRepository<LiftedTask>::StateRepository(std::shared_ptr<LiftedTask> task, ExecutionContextPtr execution_context) :
+StateRepository<LiftedTask>::StateRepository(std::shared_ptr<LiftedTask> task, ExecutionContextPtr execution_context, StateStoragePolicy storage_policy) :
     m_task(task),
-    m_context(),
-    m_fluent_backend(m_context),
-    m_derived_backend(m_context),
-    m_numeric_backend(m_context),
+    m_storage_policy(storage_policy),
+    m_storage(create_state_storage(*m_task, m_storage_policy)),
     m_unpacked_state_pool(),
     m_axiom_evaluator(std::make_shared<AxiomEvaluator<LiftedTask>>(task, execution_context))
 {
 }
 
-std::shared_ptr<StateRepository<LiftedTask>> StateRepository<LiftedTask>::create(std::shared_ptr<LiftedTask> task, ExecutionContextPtr execution_context)
+std::shared_ptr<StateRepository<LiftedTask>> StateRepository<LiftedTask>::create(std::shared_ptr<LiftedTask> task,
+                                                                                 ExecutionContextPtr execution_context,
+                                                                                 StateStoragePolicy storage_policy)
 {
-    return std::make_shared<StateRepository<LiftedTask>>(std::move(task), std::move(execution_context));
+    return std::make_shared<StateRepository<LiftedTask>>(std::move(task), std::move(execution_context), storage_policy);
 }
 
 StateView<LiftedTask> StateRepository<LiftedTask>::get_initial_state()
@@ -68,14 +71,10 @@ StateView<LiftedTask> StateRepository<LiftedTask>::get_initial_state()
 
 StateView<LiftedTask> StateRepository<LiftedTask>::get_registered_state(Index<State<LiftedTask>> state_index)
 {
-    const auto& packed_state = m_packed_states[state_index];
-
     auto unpacked_state = get_unregistered_state();
 
     unpacked_state->set(state_index);
-    m_fluent_backend.unpack(packed_state.template get_atoms<f::FluentTag>(), unpacked_state->template get_atoms<f::FluentTag>());
-    m_derived_backend.unpack(packed_state.template get_atoms<f::DerivedTag>(), unpacked_state->template get_atoms<f::DerivedTag>());
-    m_numeric_backend.unpack(packed_state.get_numeric_variables(), unpacked_state->get_numeric_variables());
+    std::visit([&](auto& storage) { storage.unpack(state_index, *unpacked_state); }, m_storage);
 
     return StateView<LiftedTask>(shared_from_this(), std::move(unpacked_state));
 }
@@ -117,24 +116,24 @@ SharedObjectPoolPtr<UnpackedState<LiftedTask>> StateRepository<LiftedTask>::get_
 
 StateView<LiftedTask> StateRepository<LiftedTask>::register_state(SharedObjectPoolPtr<UnpackedState<LiftedTask>> state)
 {
+    const auto register_trace = trace::TraceScope("register_state", "search");
+    const auto register_counters = PerfCounterScope(m_register_state_perf_counters);
+
     m_axiom_evaluator->compute_extended_state(*state);
 
-    state->set(m_packed_states
-                   .insert(Data<State<LiftedTask>>(Index<State<LiftedTask>>(m_packed_states.size()),
-                                                   m_fluent_backend.insert(state->template get_atoms<f::FluentTag>()),
-                                                   m_derived_backend.insert(state->template get_atoms<f::DerivedTag>()),
-                                                   m_numeric_backend.insert(state->get_numeric_variables())))
-                   .first);
+    state->set(std::visit([&](auto& storage) { return storage.insert(*state); }, m_storage));
 
     return StateView<LiftedTask>(shared_from_this(), std::move(state));
 }
 
+size_t StateRepository<LiftedTask>::get_num_states() const noexcept
+{
+    return std::visit([](const auto& storage) { return storage.size(); }, m_storage);
+}
+
 size_t StateRepository<LiftedTask>::memory_usage() const noexcept
 {
-    size_t bytes = 0;
-    bytes += m_context.memory_usage();
-    bytes += m_packed_states.memory_usage();
-    return bytes;
+    return std::visit([](const auto& storage) { return storage.memory_usage(); }, m_storage);
 }
 
 static_assert(StateRepositoryConcept<StateRepository<LiftedTask>, LiftedTask>);
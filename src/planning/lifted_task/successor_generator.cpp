@@ -18,6 +18,8 @@
 #include "tyr/planning/lifted_task/successor_generator.hpp"
 
 #include "../metric.hpp"
+#include "tyr/common/perf_counters.hpp"
+#include "tyr/common/trace.hpp"
 #include "tyr/datalog/bottom_up.hpp"
 #include "tyr/datalog/contexts/program.hpp"
 #include "tyr/formalism/planning/grounder.hpp"
@@ -43,11 +45,12 @@ namespace
 {
 void insert_derived_atoms_to_fact_set(const UnpackedState<LiftedTask>& state,
                                       const formalism::planning::Repository& repository,
+                                      AtomTranslationTable& atom_translation_table,
                                       fp::MergeDatalogContext& merge_context,
                                       datalog::TaggedFactSets<f::FluentTag>& fact_sets)
 {
     for (const auto atom : state.get_derived_atoms_view(repository))
-        fact_sets.predicate.insert(fp::merge_p2d<f::DerivedTag, f::FluentTag>(atom, merge_context).first);
+        fact_sets.predicate.insert(atom_translation_table.to_datalog(atom, merge_context));
 }
 
 void insert_numeric_variables_to_fact_set(const UnpackedState<LiftedTask>& state,
@@ -61,6 +64,7 @@ void insert_numeric_variables_to_fact_set(const UnpackedState<LiftedTask>& state
 
 void insert_extended_state(const UnpackedState<LiftedTask>& unpacked_state,
                            const fp::Repository& atoms_context,
+                           AtomTranslationTable& atom_translation_table,
                            fp::MergeDatalogContext& merge_context,
                            datalog::TaggedFactSets<f::FluentTag>& fact_sets,
                            datalog::TaggedAssignmentSets<f::FluentTag>& assignment_sets)
@@ -68,15 +72,17 @@ void insert_extended_state(const UnpackedState<LiftedTask>& unpacked_state,
     fact_sets.reset();
     assignment_sets.reset();
 
-    insert_fluent_atoms_to_fact_set(unpacked_state, atoms_context, merge_context, fact_sets);
-    insert_derived_atoms_to_fact_set(unpacked_state, atoms_context, merge_context, fact_sets);
+    insert_fluent_atoms_to_fact_set(unpacked_state, atoms_context, atom_translation_table, merge_context, fact_sets);
+    insert_derived_atoms_to_fact_set(unpacked_state, atoms_context, atom_translation_table, merge_context, fact_sets);
     insert_numeric_variables_to_fact_set(unpacked_state, atoms_context, merge_context, fact_sets);
 
     assignment_sets.insert(fact_sets);
 }
 }
 
-SuccessorGenerator<LiftedTask>::SuccessorGenerator(std::shared_ptr<LiftedTask> task, ExecutionContextPtr execution_context) :
+SuccessorGenerator<LiftedTask>::SuccessorGenerator(std::shared_ptr<LiftedTask> task,
+                                                   ExecutionContextPtr execution_context,
+                                                   StateStoragePolicy storage_policy) :
     m_task(std::move(task)),
     m_execution_context(std::move(execution_context)),
     m_workspace(m_task->get_action_program().get_program_context(),
@@ -84,14 +90,17 @@ SuccessorGenerator<LiftedTask>::SuccessorGenerator(std::shared_ptr<LiftedTask> t
                 d::NoOrAnnotationPolicy(),
                 d::NoAndAnnotationPolicy(),
                 d::NoTerminationPolicy()),
-    m_state_repository(std::make_shared<StateRepository<LiftedTask>>(m_task, m_execution_context)),
-    m_executor()
+    m_state_repository(std::make_shared<StateRepository<LiftedTask>>(m_task, m_execution_context, storage_policy)),
+    m_executor(),
+    m_ground_action_table(*m_task)
 {
 }
 
-std::shared_ptr<SuccessorGenerator<LiftedTask>> SuccessorGenerator<LiftedTask>::create(std::shared_ptr<LiftedTask> task, ExecutionContextPtr execution_context)
+std::shared_ptr<SuccessorGenerator<LiftedTask>> SuccessorGenerator<LiftedTask>::create(std::shared_ptr<LiftedTask> task,
+                                                                                       ExecutionContextPtr execution_context,
+                                                                                       StateStoragePolicy storage_policy)
 {
-    return std::make_shared<SuccessorGenerator<LiftedTask>>(std::move(task), std::move(execution_context));
+    return std::make_shared<SuccessorGenerator<LiftedTask>>(std::move(task), std::move(execution_context), storage_policy);
 }
 
 Node<LiftedTask> SuccessorGenerator<LiftedTask>::get_initial_node()
@@ -116,23 +125,51 @@ std::vector<LabeledNode<LiftedTask>> SuccessorGenerator<LiftedTask>::get_labeled
 
 void SuccessorGenerator<LiftedTask>::get_labeled_successor_nodes(const Node<LiftedTask>& node, std::vector<LabeledNode<LiftedTask>>& out_nodes)
 {
+    const auto successor_trace = trace::TraceScope("generate_successors", "search");
+    const auto successor_counters = PerfCounterScope(m_perf_counters);
+
     out_nodes.clear();
 
     const auto state = node.get_state();
 
+    const auto state_context = StateContext<LiftedTask>(*m_task, state.get_unpacked_state(), node.get_metric());
+
+    compute_applicable_actions(state_context, m_applicable_actions);
+
+    for (const auto ground_action : m_applicable_actions)
+        out_nodes.emplace_back(ground_action, m_executor.apply_action(state_context, ground_action, *m_state_repository));
+}
+
+void SuccessorGenerator<LiftedTask>::get_applicable_actions(const Node<LiftedTask>& node, fp::GroundActionViewList& out_actions)
+{
+    const auto successor_trace = trace::TraceScope("generate_applicable_actions", "search");
+    const auto successor_counters = PerfCounterScope(m_perf_counters);
+
+    const auto state = node.get_state();
+
+    const auto state_context = StateContext<LiftedTask>(*m_task, state.get_unpacked_state(), node.get_metric());
+
+    compute_applicable_actions(state_context, out_actions);
+}
+
+void SuccessorGenerator<LiftedTask>::compute_applicable_actions(const StateContext<LiftedTask>& state_context, fp::GroundActionViewList& out_actions)
+{
+    out_actions.clear();
+
     auto merge_context = fp::MergeDatalogContext { m_workspace.datalog_builder, m_workspace.workspace_repository };
 
-    insert_extended_state(state.get_unpacked_state(), *m_task->get_repository(), merge_context, m_workspace.facts.fact_sets, m_workspace.facts.assignment_sets);
+    insert_extended_state(state_context.unpacked_state,
+                          *m_task->get_repository(),
+                          m_task->get_action_program().get_atom_translation_table(),
+                          merge_context,
+                          m_workspace.facts.fact_sets,
+                          m_workspace.facts.assignment_sets);
 
     auto ctx = d::ProgramExecutionContext(m_workspace, m_task->get_action_program().get_const_program_workspace());
     ctx.clear();
 
     m_execution_context->arena().execute([&] { d::solve_bottom_up(ctx); });
 
-    const auto state_context = StateContext<LiftedTask>(*m_task, state.get_unpacked_state(), node.get_metric());
-
-    out_nodes.clear();
-
     auto fluent_assign = UnorderedMap<Index<fp::FDRVariable<f::FluentTag>>, fp::FDRValue> {};
     auto iter_workspace = itertools::cartesian_set::Workspace<Index<f::Object>> {};
 
@@ -152,16 +189,10 @@ void SuccessorGenerator<LiftedTask>::get_labeled_successor_nodes(const Node<Lift
                 for (const auto object : binding.get_objects())
                     m_workspace.d2p.binding.push_back(object.get_index());
 
-                const auto ground_action = fp::ground(action,
-                                                      grounder_context,
-                                                      m_task->get_parameter_domains_per_cond_effect_per_action()[uint_t(action.get_index())],
-                                                      fluent_assign,
-                                                      iter_workspace,
-                                                      *m_task->get_fdr_context())
-                                               .first;
+                const auto ground_action = m_ground_action_table.get_or_create(action, grounder_context, fluent_assign, iter_workspace);
 
                 if (m_executor.is_applicable(ground_action, state_context))
-                    out_nodes.emplace_back(ground_action, m_executor.apply_action(state_context, ground_action, *m_state_repository));
+                    out_actions.push_back(ground_action);
             }
         }
     }
@@ -184,5 +215,11 @@ Node<LiftedTask> SuccessorGenerator<LiftedTask>::get_node(Index<State<LiftedTask
     return Node<LiftedTask>(std::move(state), state_metric);
 }
 
+size_t SuccessorGenerator<LiftedTask>::memory_usage() const noexcept
+{
+    return m_state_repository->memory_usage() + m_state_repository->get_axiom_evaluator()->get_workspace().get_memory_statistics().total()
+           + m_workspace.get_memory_statistics().total() + m_ground_action_table.memory_usage();
+}
+
 static_assert(SuccessorGeneratorConcept<SuccessorGenerator<LiftedTask>, LiftedTask>);
 }
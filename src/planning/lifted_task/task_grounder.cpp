@@ -39,7 +39,12 @@
 #include "tyr/planning/programs/ground.hpp"
 #include "tyr/planning/task_utils.hpp"
 
+#include <oneapi/tbb/parallel_for.h>
+#include <utility>
+#include <vector>
+
 namespace d = tyr::datalog;
+namespace fd = tyr::formalism::datalog;
 namespace f = tyr::formalism;
 namespace fp = tyr::formalism::planning;
 
@@ -163,12 +168,49 @@ static auto create_mutex_groups(fp::GroundAtomListView<f::FluentTag> atoms, fp::
     return mutex_groups;
 }
 
-static auto create_fdr_task(const fp::PlanningTask& planning_task,
-                            fp::GroundAtomListView<f::FluentTag> fluent_atoms,
-                            fp::GroundAtomListView<f::DerivedTag> derived_atoms,
-                            fp::GroundFunctionTermListView<f::FluentTag> fluent_fterms,
-                            fp::GroundActionListView actions,
-                            fp::GroundAxiomListView axioms)
+/// @brief The ground atoms, actions, and axioms produced by one grounding partition.
+/// The indices refer to the partition's own repository, which is a child of the lifted task repository.
+struct GroundingResult
+{
+    fp::RepositoryPtr repository;
+
+    IndexList<fp::GroundAtom<f::FluentTag>> fluent_atoms;
+    IndexList<fp::GroundAtom<f::DerivedTag>> derived_atoms;
+    IndexList<fp::GroundFunctionTerm<f::FluentTag>> fluent_fterms;
+    IndexList<fp::GroundAction> actions;
+    IndexList<fp::GroundAxiom> axioms;
+
+    UnorderedSet<Index<fp::GroundAtom<f::FluentTag>>> fluent_atoms_set;
+    UnorderedSet<Index<fp::GroundAtom<f::DerivedTag>>> derived_atoms_set;
+
+    explicit GroundingResult(fp::RepositoryPtr repository) : repository(std::move(repository)) {}
+
+    void insert(fp::GroundAtomView<f::FluentTag> atom)
+    {
+        if (fluent_atoms_set.insert(atom.get_index()).second)
+            fluent_atoms.push_back(atom.get_index());
+    }
+
+    void insert(fp::GroundAtomView<f::DerivedTag> atom)
+    {
+        if (derived_atoms_set.insert(atom.get_index()).second)
+            derived_atoms.push_back(atom.get_index());
+    }
+};
+
+template<typename T>
+static auto merge_into(const std::vector<GroundingResult>& results, IndexList<T> GroundingResult::* member, fp::MergeContext& context)
+{
+    auto merged = IndexList<T> {};
+    for (const auto& result : results)
+        for (const auto element : make_view(result.*member, *result.repository))
+            merged.push_back(merge_p2p(element, context).first.get_index());
+
+    canonicalize(merged);
+    return merged;
+}
+
+static auto create_fdr_task(const fp::PlanningTask& planning_task, const std::vector<GroundingResult>& results)
 {
     auto task = planning_task.get_task();
     const auto& factory = planning_task.get_domain().get_repository_factory();
@@ -189,12 +231,15 @@ static auto create_fdr_task(const fp::PlanningTask& planning_task,
 
     for (const auto atom : task.get_atoms<f::StaticTag>())
         fdr_task.static_atoms.push_back(merge_p2p(atom, merge_context).first.get_index());
+
+    // Results of different partitions may share atoms, so we deduplicate after merging into the common repository.
+    const auto fluent_atoms = merge_into(results, &GroundingResult::fluent_atoms, merge_context);
     for (const auto atom : fluent_atoms)
-        fdr_task.fluent_atoms.push_back(merge_p2p(atom, merge_context).first.get_index());
-    for (const auto atom : derived_atoms)
-        fdr_task.derived_atoms.push_back(merge_p2p(atom, merge_context).first.get_index());
-    for (const auto fterm : fluent_fterms)
-        fdr_task.fluent_fterms.push_back(merge_p2p(fterm, merge_context).first.get_index());
+        fdr_task.fluent_atoms.push_back(atom);
+    for (const auto atom : merge_into(results, &GroundingResult::derived_atoms, merge_context))
+        fdr_task.derived_atoms.push_back(atom);
+    for (const auto fterm : merge_into(results, &GroundingResult::fluent_fterms, merge_context))
+        fdr_task.fluent_fterms.push_back(fterm);
 
     for (const auto fterm_value : task.get_fterm_values<f::StaticTag>())
         fdr_task.static_fterm_values.push_back(merge_p2p(fterm_value, merge_context).first.get_index());
@@ -208,7 +253,7 @@ static auto create_fdr_task(const fp::PlanningTask& planning_task,
         fdr_task.axioms.push_back(merge_p2p(axiom, merge_context).first.get_index());
 
     /// --- Create FDR context
-    auto mutex_groups = create_mutex_groups(fluent_atoms, merge_context);
+    auto mutex_groups = create_mutex_groups(make_view(fluent_atoms, *repository), merge_context);
     auto fdr_context = std::make_shared<fp::FDRContext>(mutex_groups, repository);
 
     /// --- Create FDR variables
@@ -222,11 +267,14 @@ static auto create_fdr_task(const fp::PlanningTask& planning_task,
     /// --- Create FDR goal
     fdr_task.goal = create_ground_fdr_conjunctive_condition(task.get_goal(), *fdr_context, merge_context).first.get_index();
 
-    /// --- Create FDR actions and axioms
-    for (const auto action : actions)
-        fdr_task.ground_actions.push_back(create_ground_action(action, *fdr_context, merge_context).first.get_index());
-    for (const auto axiom : axioms)
-        fdr_task.ground_axioms.push_back(create_ground_axiom(axiom, *fdr_context, merge_context).first.get_index());
+    /// --- Create FDR actions and axioms in partition order, which is the order of the bindings.
+    for (const auto& result : results)
+    {
+        for (const auto action : make_view(result.actions, *result.repository))
+            fdr_task.ground_actions.push_back(create_ground_action(action, *fdr_context, merge_context).first.get_index());
+        for (const auto axiom : make_view(result.axioms, *result.repository))
+            fdr_task.ground_axioms.push_back(create_ground_axiom(axiom, *fdr_context, merge_context).first.get_index());
+    }
 
     canonicalize(fdr_task);
 
@@ -234,19 +282,100 @@ static auto create_fdr_task(const fp::PlanningTask& planning_task,
         fp::PlanningFDRTask(repository->get_or_create(fdr_task).first, std::move(fdr_context), repository, planning_task.get_domain()));
 }
 
-static auto create_fdr_task(const fp::PlanningTask& task,
-                            IndexList<fp::GroundAtom<f::FluentTag>> fluent_atoms,
-                            IndexList<fp::GroundAtom<f::DerivedTag>> derived_atoms,
-                            IndexList<fp::GroundFunctionTerm<f::FluentTag>> fluent_fterms,
-                            IndexList<fp::GroundAction> actions,
-                            IndexList<fp::GroundAxiom> axioms)
+static void collect_atoms(fp::GroundConjunctiveConditionView condition, GroundingResult& result)
+{
+    for (const auto fact : condition.get_facts<f::FluentTag>())
+        for (const auto atom : fact.get_variable().get_atoms())
+            result.insert(atom);
+
+    for (const auto literal : condition.get_facts<f::DerivedTag>())
+        result.insert(literal.get_atom());
+}
+
+/// @brief Ground the actions and axioms of the bindings in the given ranges into the result's repository.
+/// Runs concurrently with other partitions: the lifted task repository and FDR context are only read.
+static void ground_partition(LiftedTask& lifted_task,
+                             const std::vector<std::pair<fp::ActionView, fd::PredicateBindingView<f::FluentTag>>>& action_bindings,
+                             std::pair<size_t, size_t> action_range,
+                             const std::vector<std::pair<fp::AxiomView, fd::PredicateBindingView<f::FluentTag>>>& axiom_bindings,
+                             std::pair<size_t, size_t> axiom_range,
+                             const boost::dynamic_bitset<>& static_atoms_bitset,
+                             GroundingResult& result)
+{
+    auto builder = fp::Builder();
+    auto fdr_context = fp::FDRContext(*lifted_task.get_fdr_context(), builder, result.repository);
+    auto binding = IndexList<f::Object> {};
+    auto fluent_assign = UnorderedMap<Index<fp::FDRVariable<f::FluentTag>>, fp::FDRValue> {};
+    auto derived_assign = UnorderedMap<Index<fp::GroundAtom<f::DerivedTag>>, bool> {};
+    auto iter_workspace = itertools::cartesian_set::Workspace<Index<f::Object>> {};
+
+    auto grounder_context = fp::GrounderContext { builder, *result.repository, binding };
+
+    /// --- Ground Actions
+
+    for (size_t i = action_range.first; i < action_range.second; ++i)
+    {
+        const auto& [action, predicate_binding] = action_bindings[i];
+
+        binding.clear();
+        for (const auto object : predicate_binding.get_objects())
+            binding.push_back(object.get_index());
+
+        const auto ground_action = fp::ground(action,
+                                              grounder_context,
+                                              lifted_task.get_parameter_domains_per_cond_effect_per_action()[uint_t(action.get_index())],
+                                              fluent_assign,
+                                              iter_workspace,
+                                              fdr_context)
+                                       .first;
+
+        assert(is_statically_applicable(ground_action, static_atoms_bitset));
+
+        if (is_consistent(ground_action, fluent_assign, derived_assign))
+        {
+            result.actions.push_back(ground_action.get_index());
+
+            collect_atoms(ground_action.get_condition(), result);
+
+            for (const auto cond_effect : ground_action.get_effects())
+            {
+                collect_atoms(cond_effect.get_condition(), result);
+
+                for (const auto fact : cond_effect.get_effect().get_facts())
+                    for (const auto atom : fact.get_variable().get_atoms())
+                        result.insert(atom);
+            }
+        }
+    }
+
+    /// --- Ground Axioms
+
+    for (size_t i = axiom_range.first; i < axiom_range.second; ++i)
+    {
+        const auto& [axiom, predicate_binding] = axiom_bindings[i];
+
+        binding.clear();
+        for (const auto object : predicate_binding.get_objects())
+            binding.push_back(object.get_index());
+
+        const auto ground_axiom = fp::ground(axiom, grounder_context, fdr_context).first;
+
+        assert(is_statically_applicable(ground_axiom, static_atoms_bitset));
+
+        if (is_consistent(ground_axiom, fluent_assign, derived_assign))
+        {
+            result.axioms.push_back(ground_axiom.get_index());
+
+            collect_atoms(ground_axiom.get_body(), result);
+
+            result.insert(ground_axiom.get_head());
+        }
+    }
+}
+
+static auto get_partition_range(size_t size, size_t partition, size_t num_partitions)
 {
-    return create_fdr_task(task,
-                           make_view(fluent_atoms, *task.get_repository()),
-                           make_view(derived_atoms, *task.get_repository()),
-                           make_view(fluent_fterms, *task.get_repository()),
-                           make_view(actions, *task.get_repository()),
-                           make_view(axioms, *task.get_repository()));
+    return std::make_pair(size * partition / num_partitions, size * (partition + 1) / num_partitions);
 }
 
 GroundTaskPtr ground_task(LiftedTask& lifted_task, ExecutionContext& execution_context)
@@ -271,148 +400,79 @@ GroundTaskPtr ground_task(LiftedTask& lifted_task, ExecutionContext& execution_c
 
     execution_context.arena().execute([&] { d::solve_bottom_up(ctx); });
 
-    workspace.d2p.clear();
-
-    auto fluent_assign = UnorderedMap<Index<fp::FDRVariable<f::FluentTag>>, fp::FDRValue> {};
-    auto derived_assign = UnorderedMap<Index<fp::GroundAtom<f::DerivedTag>>, bool> {};
-    auto iter_workspace = itertools::cartesian_set::Workspace<Index<f::Object>> {};
-
     /// --- Ground Atoms
 
-    auto fluent_atoms_set = UnorderedSet<Index<fp::GroundAtom<f::FluentTag>>>();
-    auto derived_atoms_set = UnorderedSet<Index<fp::GroundAtom<f::DerivedTag>>>();
-    auto fluent_fterms_set = UnorderedSet<Index<fp::GroundFunctionTerm<f::FluentTag>>>();
+    // The initial atoms and goal atoms live in the lifted task repository.
+    const auto num_partitions = execution_context.get_num_threads();
+    auto results = std::vector<GroundingResult> {};
+    results.reserve(num_partitions + 1);
+    auto& initial_result = results.emplace_back(lifted_task.get_repository());
     // TODO: collect fluent function terms
 
     for (const auto atom : lifted_task.get_task().get_atoms<f::FluentTag>())
-        fluent_atoms_set.insert(atom.get_index());
+        initial_result.insert(atom);
 
     // Collect the goal facts
     for (const auto fact : lifted_task.get_task().get_goal().get_facts<f::FluentTag>())
         for (const auto atom : fact.get_variable().get_atoms())
-            fluent_atoms_set.insert(atom.get_index());
+            initial_result.insert(atom);
 
     for (const auto literal : lifted_task.get_task().get_goal().get_facts<f::DerivedTag>())
-        derived_atoms_set.insert(literal.get_atom().get_index());
+        initial_result.insert(literal.get_atom());
 
-    /// --- Ground Actions
+    /// --- Collect the bindings of the applicability predicates
 
-    auto ground_actions_set = UnorderedSet<Index<fp::GroundAction>> {};
+    auto action_bindings = std::vector<std::pair<fp::ActionView, fd::PredicateBindingView<f::FluentTag>>> {};
+    auto axiom_bindings = std::vector<std::pair<fp::AxiomView, fd::PredicateBindingView<f::FluentTag>>> {};
 
-    auto static_atoms_bitset = boost::dynamic_bitset<>();
-    for (const auto atom : lifted_task.get_task().get_atoms<f::StaticTag>())
-        set(uint_t(atom.get_index()), true, static_atoms_bitset);
+    const auto& actions_mapping = ground_program.get_predicate_to_actions_mapping();
+    const auto& axioms_mapping = ground_program.get_predicate_to_axioms_mapping();
 
-    /// TODO: store facts by predicate such that we can swap the iteration, i.e., first over get_predicate_to_actions_mapping, then facts of the predicate
     for (const auto& set : workspace.facts.fact_sets.predicate.get_sets())
     {
         for (const auto& binding : set.get_bindings())
         {
-            const auto& mapping = ground_program.get_predicate_to_actions_mapping();
-
-            if (const auto it = mapping.find(binding.get_relation()); it != mapping.end())
-            {
-                const auto action = it->second;
-
-                workspace.d2p.binding.clear();
-                for (const auto object : binding.get_objects())
-                    workspace.d2p.binding.push_back(object.get_index());
-
-                auto grounder_context = fp::GrounderContext { workspace.planning_builder, *lifted_task.get_repository(), workspace.d2p.binding };
-
-                const auto ground_action = fp::ground(action,
-                                                      grounder_context,
-                                                      lifted_task.get_parameter_domains_per_cond_effect_per_action()[uint_t(action.get_index())],
-                                                      fluent_assign,
-                                                      iter_workspace,
-                                                      *lifted_task.get_fdr_context())
-                                               .first;
-
-                assert(is_statically_applicable(ground_action, static_atoms_bitset));
-
-                if (is_consistent(ground_action, fluent_assign, derived_assign))
-                {
-                    ground_actions_set.insert(ground_action.get_index());
-
-                    for (const auto fact : ground_action.get_condition().get_facts<f::FluentTag>())
-                        for (const auto atom : fact.get_variable().get_atoms())
-                            fluent_atoms_set.insert(atom.get_index());
-
-                    for (const auto literal : ground_action.get_condition().get_facts<f::DerivedTag>())
-                        derived_atoms_set.insert(literal.get_atom().get_index());
-
-                    for (const auto cond_effect : ground_action.get_effects())
-                    {
-                        for (const auto fact : cond_effect.get_condition().get_facts<f::FluentTag>())
-                            for (const auto atom : fact.get_variable().get_atoms())
-                                fluent_atoms_set.insert(atom.get_index());
+            if (const auto it = actions_mapping.find(binding.get_relation()); it != actions_mapping.end())
+                action_bindings.emplace_back(it->second, binding);
 
-                        for (const auto literal : cond_effect.get_condition().get_facts<f::DerivedTag>())
-                            derived_atoms_set.insert(literal.get_atom().get_index());
-
-                        for (const auto fact : cond_effect.get_effect().get_facts())
-                            for (const auto atom : fact.get_variable().get_atoms())
-                                fluent_atoms_set.insert(atom.get_index());
-                    }
-                }
-            }
+            if (const auto it = axioms_mapping.find(binding.get_relation()); it != axioms_mapping.end())
+                axiom_bindings.emplace_back(it->second, binding);
         }
     }
 
-    /// --- Ground Axioms
-
-    auto ground_axioms_set = UnorderedSet<Index<fp::GroundAxiom>> {};
-
-    for (const auto& set : workspace.facts.fact_sets.predicate.get_sets())
-    {
-        for (const auto& binding : set.get_bindings())
-        {
-            const auto& mapping = ground_program.get_predicate_to_axioms_mapping();
-
-            if (const auto it = mapping.find(binding.get_relation()); it != mapping.end())
-            {
-                const auto axiom = it->second;
-
-                workspace.d2p.binding.clear();
-                for (const auto object : binding.get_objects())
-                    workspace.d2p.binding.push_back(object.get_index());
-
-                auto grounder_context = fp::GrounderContext { workspace.planning_builder, *lifted_task.get_repository(), workspace.d2p.binding };
-
-                const auto ground_axiom = fp::ground(axiom, grounder_context, *lifted_task.get_fdr_context()).first;
-
-                assert(is_statically_applicable(ground_axiom, static_atoms_bitset));
-
-                if (is_consistent(ground_axiom, fluent_assign, derived_assign))
-                {
-                    ground_axioms_set.insert(ground_axiom.get_index());
-
-                    for (const auto fact : ground_axiom.get_body().get_facts<f::FluentTag>())
-                        for (const auto atom : fact.get_variable().get_atoms())
-                            fluent_atoms_set.insert(atom.get_index());
-
-                    for (const auto literal : ground_axiom.get_body().get_facts<f::DerivedTag>())
-                        derived_atoms_set.insert(literal.get_atom().get_index());
-
-                    derived_atoms_set.insert(ground_axiom.get_head().get_index());
-                }
-            }
-        }
-    }
+    auto static_atoms_bitset = boost::dynamic_bitset<>();
+    for (const auto atom : lifted_task.get_task().get_atoms<f::StaticTag>())
+        set(uint_t(atom.get_index()), true, static_atoms_bitset);
 
-    auto fluent_atoms = IndexList<fp::GroundAtom<f::FluentTag>>(fluent_atoms_set.begin(), fluent_atoms_set.end());
-    auto derived_atoms = IndexList<fp::GroundAtom<f::DerivedTag>>(derived_atoms_set.begin(), derived_atoms_set.end());
-    auto fluent_fterms = IndexList<fp::GroundFunctionTerm<f::FluentTag>>(fluent_fterms_set.begin(), fluent_fterms_set.end());
-    auto ground_actions = IndexList<fp::GroundAction>(ground_actions_set.begin(), ground_actions_set.end());
-    auto ground_axioms = IndexList<fp::GroundAxiom>(ground_axioms_set.begin(), ground_axioms_set.end());
+    /// --- Ground Actions and Axioms
 
-    canonicalize(fluent_atoms);
-    canonicalize(derived_atoms);
-    canonicalize(fluent_fterms);
-    canonicalize(ground_actions);
-    canonicalize(ground_axioms);
+    // Each partition grounds a contiguous range of bindings into its own child repository.
+    // Concatenating the partitions in order yields the binding order, so the result does not depend on the number of threads.
+    // The repository factory is not thread-safe, so the child repositories are created upfront.
+    const auto& factory = lifted_task.get_formalism_task().get_domain().get_repository_factory();
+    for (size_t i = 0; i < num_partitions; ++i)
+        results.emplace_back(factory->create_shared(lifted_task.get_repository().get()));
 
-    return create_fdr_task(lifted_task.get_formalism_task(), fluent_atoms, derived_atoms, fluent_fterms, ground_actions, ground_axioms);
+    execution_context.arena().execute(
+        [&]
+        {
+            oneapi::tbb::parallel_for(size_t(0),
+                                      num_partitions,
+                                      [&](size_t i)
+                                      {
+                                          ground_partition(lifted_task,
+                                                           action_bindings,
+                                                           get_partition_range(action_bindings.size(), i, num_partitions),
+                                                           axiom_bindings,
+                                                           get_partition_range(axiom_bindings.size(), i, num_partitions),
+                                                           static_atoms_bitset,
+                                                           results[i + 1]);
+                                      });
+        });
+
+    /// --- Merge the partitions into the FDR task
+
+    return create_fdr_task(lifted_task.get_formalism_task(), results);
 }
 
 }
@@ -177,7 +177,8 @@ static auto create_program_context(fp::TaskView task, ApplicableActionProgram::A
 ApplicableActionProgram::ApplicableActionProgram(fp::TaskView task) :
     m_predicate_to_actions(),
     m_program_context(action::create_program_context(task, m_predicate_to_actions)),
-    m_program_workspace(m_program_context)
+    m_program_workspace(m_program_context),
+    m_atom_translation_table()
 {
     // std::cout << m_program_context.get_program() << std::endl;
 }
@@ -192,4 +193,8 @@ datalog::ProgramContext& ApplicableActionProgram::get_program_context() noexcept
 const datalog::ProgramContext& ApplicableActionProgram::get_program_context() const noexcept { return m_program_context; }
 
 const datalog::ConstProgramWorkspace& ApplicableActionProgram::get_const_program_workspace() const noexcept { return m_program_workspace; }
+
+AtomTranslationTable& ApplicableActionProgram::get_atom_translation_table() noexcept { return m_atom_translation_table; }
+
+const AtomTranslationTable& ApplicableActionProgram::get_atom_translation_table() const noexcept { return m_atom_translation_table; }
 }
@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2025 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "tyr/planning/programs/atom_translation_table.hpp"
+
+#include "tyr/common/memory_usage.hpp"
+#include "tyr/formalism/planning/merge_datalog.hpp"
+#include "tyr/formalism/planning/merge_planning.hpp"
+
+#include <type_traits>
+
+namespace f = tyr::formalism;
+namespace fd = tyr::formalism::datalog;
+namespace fp = tyr::formalism::planning;
+
+namespace tyr::planning
+{
+
+template<f::FactKind T>
+std::vector<AtomTranslationTable::DatalogBinding>& AtomTranslationTable::get_p2d_table() noexcept
+{
+    if constexpr (std::is_same_v<T, f::FluentTag>)
+        return m_fluent_p2d;
+    else if constexpr (std::is_same_v<T, f::DerivedTag>)
+        return m_derived_p2d;
+    else
+        static_assert(dependent_false<T>::value, "Missing case");
+}
+
+template<f::FactKind T>
+fd::PredicateBindingView<f::FluentTag> AtomTranslationTable::to_datalog(fp::GroundAtomView<T> atom, fp::MergeDatalogContext& context)
+{
+    auto& table = get_p2d_table<T>();
+
+    const auto i = uint_t(atom.get_index());
+    if (i >= table.size())
+        table.resize(i + 1);
+
+    auto& binding = table[i];
+    if (binding.row == Index<f::Row>::max())
+        binding = fp::merge_p2d<T, f::FluentTag>(atom.get_row(), context).first.get_index();
+
+    return make_view(binding, context.destination);
+}
+
+template fd::PredicateBindingView<f::FluentTag> AtomTranslationTable::to_datalog(fp::GroundAtomView<f::FluentTag> atom, fp::MergeDatalogContext& context);
+template fd::PredicateBindingView<f::FluentTag> AtomTranslationTable::to_datalog(fp::GroundAtomView<f::DerivedTag> atom, fp::MergeDatalogContext& context);
+
+fp::GroundAtomView<f::DerivedTag> AtomTranslationTable::to_planning(fd::PredicateBindingView<f::FluentTag> binding, fp::MergePlanningContext& context)
+{
+    const auto relation = uint_t(binding.get_index().relation);
+    if (relation >= m_derived_d2p.size())
+        m_derived_d2p.resize(relation + 1);
+
+    auto& table = m_derived_d2p[relation];
+
+    const auto row = uint_t(binding.get_index().row);
+    if (row >= table.size())
+        table.resize(row + 1);
+
+    auto& atom = table[row];
+    if (atom == Index<fp::GroundAtom<f::DerivedTag>>::max())
+        atom = fp::merge_atom_d2p<f::FluentTag, f::DerivedTag>(binding, context).first.get_index();
+
+    return make_view(atom, context.destination);
+}
+
+void AtomTranslationTable::clear() noexcept
+{
+    m_fluent_p2d.clear();
+    m_derived_p2d.clear();
+    m_derived_d2p.clear();
+}
+
+size_t AtomTranslationTable::memory_usage() const noexcept
+{
+    return get_memory_usage(m_fluent_p2d) + get_memory_usage(m_derived_p2d) + get_memory_usage(m_derived_d2p);
+}
+
+}
@@ -160,7 +160,8 @@ static auto create_program_context(fp::TaskView task, AxiomEvaluatorProgram::Pre
 AxiomEvaluatorProgram::AxiomEvaluatorProgram(fp::TaskView task) :
     m_predicate_to_predicate(),
     m_program_context(axiom::create_program_context(task, m_predicate_to_predicate)),
-    m_program_workspace(m_program_context)
+    m_program_workspace(m_program_context),
+    m_atom_translation_table()
 {
     // std::cout << m_program_context.get_program() << std::endl;
 }
@@ -175,4 +176,8 @@ datalog::ProgramContext& AxiomEvaluatorProgram::get_program_context() noexcept {
 const datalog::ProgramContext& AxiomEvaluatorProgram::get_program_context() const noexcept { return m_program_context; }
 
 const datalog::ConstProgramWorkspace& AxiomEvaluatorProgram::get_const_program_workspace() const noexcept { return m_program_workspace; }
+
+AtomTranslationTable& AxiomEvaluatorProgram::get_atom_translation_table() noexcept { return m_atom_translation_table; }
+
+const AtomTranslationTable& AxiomEvaluatorProgram::get_atom_translation_table() const noexcept { return m_atom_translation_table; }
 }
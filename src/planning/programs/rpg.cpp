@@ -27,6 +27,11 @@
 #include "tyr/formalism/planning/repository.hpp"
 #include "tyr/formalism/planning/views.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
 namespace f = tyr::formalism;
 namespace d = tyr::datalog;
 namespace fp = tyr::formalism::planning;
@@ -79,13 +84,78 @@ static auto create_cond_effect_rule(fp::ActionView action,
     return context.destination.get_or_create(rule);
 }
 
+using StaticFunctionMinValues = UnorderedMap<Index<f::Function<f::StaticTag>>, float_t>;
+
+static auto compute_static_function_min_values(fp::TaskView task)
+{
+    auto min_values = StaticFunctionMinValues {};
+
+    for (const auto fterm_value : task.get_fterm_values<f::StaticTag>())
+    {
+        const auto function = fterm_value.get_fterm().get_function().get_index();
+        const auto [it, inserted] = min_values.emplace(function, fterm_value.get_value());
+        if (!inserted)
+            it->second = std::min(it->second, fterm_value.get_value());
+    }
+
+    return min_values;
+}
+
+/// @brief Compute a lower bound on the increment of the auxiliary function over all groundings of the given expression.
+static float_t compute_cost_lower_bound(fp::FunctionExpressionView fexpr, const StaticFunctionMinValues& min_values)
+{
+    return visit(
+        [&](auto&& arg) -> float_t
+        {
+            using Alternative = std::decay_t<decltype(arg)>;
+
+            if constexpr (std::is_same_v<Alternative, float_t>)
+                return std::max(arg, float_t(0));
+            else if constexpr (std::is_same_v<Alternative, fp::FunctionTermView<f::StaticTag>>)
+            {
+                const auto it = min_values.find(arg.get_function().get_index());
+                return (it != min_values.end()) ? std::max(it->second, float_t(0)) : float_t(0);
+            }
+            else
+                return float_t(0);  ///< Arithmetic expressions and fluent function terms
+        },
+        fexpr.get_variant());
+}
+
+static float_t compute_cost_lower_bound(fp::ConditionalEffectView cond_eff, const StaticFunctionMinValues& min_values)
+{
+    const auto numeric_effect = cond_eff.get_effect().get_auxiliary_numeric_effect();
+    if (!numeric_effect.has_value())
+        return float_t(0);
+
+    return visit([&](auto&& arg) { return compute_cost_lower_bound(arg.get_fexpr(), min_values); }, numeric_effect.value().get_variant());
+}
+
+static bool is_unconditional(fp::ConditionalEffectView cond_eff)
+{
+    const auto condition = cond_eff.get_condition();
+
+    return cond_eff.get_variables().empty() && condition.get_literals<f::StaticTag>().empty() && condition.get_literals<f::FluentTag>().empty()
+           && condition.get_literals<f::DerivedTag>().empty() && condition.get_numeric_constraints().empty();
+}
+
 static void translate_action_to_delete_free_rules(fp::ActionView action,
                                                   Data<fd::Program>& program,
                                                   fp::MergeDatalogContext& context,
-                                                  RPGProgram::RuleToActionMapping& rule_to_action)
+                                                  const StaticFunctionMinValues& min_values,
+                                                  RPGProgram::RuleToActionMapping& rule_to_action,
+                                                  std::vector<float_t>& rule_action_costs)
 {
+    // Every rule pays for the unconditional effects of its action.
+    auto unconditional_cost = float_t(0);
+    for (const auto cond_eff : action.get_effects())
+        if (is_unconditional(cond_eff))
+            unconditional_cost += compute_cost_lower_bound(cond_eff, min_values);
+
     for (const auto cond_eff : action.get_effects())
     {
+        const auto cost = is_unconditional(cond_eff) ? unconditional_cost : unconditional_cost + compute_cost_lower_bound(cond_eff, min_values);
+
         for (const auto literal : cond_eff.get_effect().get_literals())
         {
             if (!literal.get_polarity())
@@ -95,11 +165,20 @@ static void translate_action_to_delete_free_rules(fp::ActionView action,
 
             program.rules.push_back(rule.get_index());
             rule_to_action.emplace(rule, action);
+
+            // Structurally equal rules of different actions collapse into one, keep the cheapest.
+            const auto i = uint_t(rule.get_index());
+            if (i >= rule_action_costs.size())
+                rule_action_costs.resize(i + 1, std::numeric_limits<float_t>::infinity());
+            rule_action_costs[i] = std::min(rule_action_costs[i], cost);
         }
     }
 }
 
-static auto create_program(fp::TaskView task, fd::Repository& destination, RPGProgram::RuleToActionMapping& rule_to_action)
+static auto create_program(fp::TaskView task,
+                           fd::Repository& destination,
+                           RPGProgram::RuleToActionMapping& rule_to_action,
+                           std::vector<float_t>& rule_action_costs)
 {
     auto builder = fd::Builder();
     auto context = fp::MergeDatalogContext(builder, destination);
@@ -126,18 +205,25 @@ static auto create_program(fp::TaskView task, fd::Repository& destination, RPGPr
     for (const auto atom : task.get_atoms<f::FluentTag>())
         program.fluent_atoms.push_back(fp::merge_p2d(atom, context).first.get_index());
 
+    const auto min_values = compute_static_function_min_values(task);
+
     for (const auto action : task.get_domain().get_actions())
-        translate_action_to_delete_free_rules(action, program, context, rule_to_action);
+        translate_action_to_delete_free_rules(action, program, context, min_values, rule_to_action, rule_action_costs);
+
+    // Rule indices that belong to no action, if any, cost nothing.
+    for (auto& cost : rule_action_costs)
+        if (std::isinf(cost))
+            cost = float_t(0);
 
     canonicalize(program);
     return destination.get_or_create(program).first;
 }
 
-static auto create_program_context(fp::TaskView task, RPGProgram::RuleToActionMapping& rule_to_action)
+static auto create_program_context(fp::TaskView task, RPGProgram::RuleToActionMapping& rule_to_action, std::vector<float_t>& rule_action_costs)
 {
     auto factory = std::make_shared<fd::RepositoryFactory>();
     auto repository = factory->create_shared();
-    auto program = create_program(task, *repository, rule_to_action);
+    auto program = create_program(task, *repository, rule_to_action, rule_action_costs);
     auto domains = analysis::compute_variable_domains(program);
     auto strata = analysis::compute_rule_stratification(program);
     auto listeners = analysis::compute_listeners(strata, *repository);
@@ -145,22 +231,63 @@ static auto create_program_context(fp::TaskView task, RPGProgram::RuleToActionMa
     return datalog::ProgramContext(program, std::move(repository), std::move(factory), std::move(domains), std::move(strata), std::move(listeners));
 }
 
+/// @brief Return the least power of ten up to 1000 that makes all costs integral, or 1000 if there is none.
+static float_t compute_action_cost_scale(const std::vector<float_t>& rule_action_costs)
+{
+    constexpr auto kMaxScale = float_t(1000);
+    constexpr auto kEpsilon = float_t(1e-6);
+
+    auto scale = float_t(1);
+    for (const auto cost : rule_action_costs)
+        while (scale < kMaxScale && std::abs(cost * scale - std::round(cost * scale)) > kEpsilon)
+            scale *= 10;
+
+    return scale;
+}
+
+static auto compute_scaled_rule_action_costs(const std::vector<float_t>& rule_action_costs, float_t scale)
+{
+    constexpr auto kMaxCost = float_t(std::numeric_limits<datalog::Cost>::max());
+    constexpr auto kEpsilon = float_t(1e-6);
+
+    auto scaled_costs = std::vector<datalog::Cost>();
+    scaled_costs.reserve(rule_action_costs.size());
+    for (const auto cost : rule_action_costs)
+        scaled_costs.push_back(datalog::Cost(std::min(std::floor(cost * scale + kEpsilon), kMaxCost)));  ///< Round down to remain a lower bound
+
+    return std::make_shared<const std::vector<datalog::Cost>>(std::move(scaled_costs));
+}
+
 }
 
 RPGProgram::RPGProgram(fp::TaskView task) :
     m_rule_to_action(),
-    m_program_context(rpg::create_program_context(task, m_rule_to_action)),
-    m_program_workspace(m_program_context)
+    m_rule_action_costs(),
+    m_program_context(rpg::create_program_context(task, m_rule_to_action, m_rule_action_costs)),
+    m_action_cost_scale(rpg::compute_action_cost_scale(m_rule_action_costs)),
+    m_scaled_rule_action_costs(rpg::compute_scaled_rule_action_costs(m_rule_action_costs, m_action_cost_scale)),
+    m_program_workspace(m_program_context),
+    m_atom_translation_table()
 {
     // std::cout << m_program_context.get_program() << std::endl;
 }
 
 const RPGProgram::RuleToActionMapping& RPGProgram::get_rule_to_action_mapping() const noexcept { return m_rule_to_action; }
 
+const std::vector<float_t>& RPGProgram::get_rule_action_costs() const noexcept { return m_rule_action_costs; }
+
+float_t RPGProgram::get_action_cost_scale() const noexcept { return m_action_cost_scale; }
+
+const std::shared_ptr<const std::vector<datalog::Cost>>& RPGProgram::get_scaled_rule_action_costs() const noexcept { return m_scaled_rule_action_costs; }
+
 datalog::ProgramContext& RPGProgram::get_program_context() noexcept { return m_program_context; }
 
 const datalog::ProgramContext& RPGProgram::get_program_context() const noexcept { return m_program_context; }
 
 const datalog::ConstProgramWorkspace& RPGProgram::get_const_program_workspace() const noexcept { return m_program_workspace; }
 
+AtomTranslationTable& RPGProgram::get_atom_translation_table() noexcept { return m_atom_translation_table; }
+
+const AtomTranslationTable& RPGProgram::get_atom_translation_table() const noexcept { return m_atom_translation_table; }
+
 }
\ No newline at end of file
@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2025 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "tyr/planning/state_storage/storage.hpp"
+
+#include "tyr/planning/ground_task.hpp"
+#include "tyr/planning/ground_task/state_data.hpp"
+#include "tyr/planning/ground_task/state_storage/hash_set/atom.hpp"
+#include "tyr/planning/ground_task/state_storage/hash_set/fact.hpp"
+#include "tyr/planning/ground_task/state_storage/tree_compression/atom.hpp"
+#include "tyr/planning/ground_task/state_storage/tree_compression/fact.hpp"
+#include "tyr/planning/ground_task/unpacked_state.hpp"
+#include "tyr/planning/lifted_task.hpp"
+#include "tyr/planning/lifted_task/state_data.hpp"
+#include "tyr/planning/lifted_task/state_storage/hash_set/atom.hpp"
+#include "tyr/planning/lifted_task/state_storage/hash_set/fact.hpp"
+#include "tyr/planning/lifted_task/state_storage/tree_compression/atom.hpp"
+#include "tyr/planning/lifted_task/state_storage/tree_compression/fact.hpp"
+#include "tyr/planning/lifted_task/unpacked_state.hpp"
+#include "tyr/planning/state_storage/hash_set/numeric.hpp"
+#include "tyr/planning/state_storage/tree_compression/numeric.hpp"
+
+#include <stdexcept>
+#include <type_traits>
+
+namespace f = tyr::formalism;
+
+namespace tyr::planning
+{
+namespace
+{
+template<typename Task, typename Tag>
+StateStorageContext<Task, Tag> create_context(const Task& task)
+{
+    if constexpr (std::is_constructible_v<StateStorageContext<Task, Tag>, const Task&>)
+        return StateStorageContext<Task, Tag>(task);
+    else
+        return StateStorageContext<Task, Tag>();
+}
+}
+
+template<typename Task, typename Tag>
+StateStorage<Task, Tag>::StateStorage(const Task& task) :
+    m_context(create_context<Task, Tag>(task)),
+    m_fluent_backend(m_context),
+    m_derived_backend(m_context),
+    m_numeric_backend(m_context),
+    m_packed_states()
+{
+}
+
+template<typename Task, typename Tag>
+Index<State<Task>> StateStorage<Task, Tag>::insert(const UnpackedState<Task>& state)
+{
+    const auto index = m_packed_states
+                           .insert(Data<PackedState<Task, Tag>>(m_fluent_backend.insert(state.template get_atoms<f::FluentTag>()),
+                                                                m_derived_backend.insert(state.template get_atoms<f::DerivedTag>()),
+                                                                m_numeric_backend.insert(state.get_numeric_variables())))
+                           .first;
+
+    return Index<State<Task>>(uint_t(index));
+}
+
+template<typename Task, typename Tag>
+void StateStorage<Task, Tag>::unpack(Index<State<Task>> index, UnpackedState<Task>& state)
+{
+    const auto& packed_state = m_packed_states[Index<PackedState<Task, Tag>>(uint_t(index))];
+
+    m_fluent_backend.unpack(packed_state.template get_atoms<f::FluentTag>(), state.template get_atoms<f::FluentTag>());
+    m_derived_backend.unpack(packed_state.template get_atoms<f::DerivedTag>(), state.template get_atoms<f::DerivedTag>());
+    m_numeric_backend.unpack(packed_state.get_numeric_variables(), state.get_numeric_variables());
+}
+
+template class StateStorage<LiftedTask, TreeCompression>;
+template class StateStorage<LiftedTask, HashSet>;
+template class StateStorage<GroundTask, TreeCompression>;
+template class StateStorage<GroundTask, HashSet>;
+
+template<typename Task>
+StateStorageVariant<Task> create_state_storage(const Task& task, StateStoragePolicy policy)
+{
+    switch (policy)
+    {
+        case StateStoragePolicy::TREE_COMPRESSION:
+            return StateStorageVariant<Task>(std::in_place_type<StateStorage<Task, TreeCompression>>, task);
+        case StateStoragePolicy::HASH_SET:
+            return StateStorageVariant<Task>(std::in_place_type<StateStorage<Task, HashSet>>, task);
+        default:
+            throw std::invalid_argument("create_state_storage(task, policy): unexpected state storage policy.");
+    }
+}
+
+template StateStorageVariant<LiftedTask> create_state_storage(const LiftedTask& task, StateStoragePolicy policy);
+template StateStorageVariant<GroundTask> create_state_storage(const GroundTask& task, StateStoragePolicy policy);
+
+}
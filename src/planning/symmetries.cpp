@@ -0,0 +1,558 @@
+/*
+ * Copyright (C) 2025 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "tyr/planning/symmetries.hpp"
+
+#include "tyr/common/config.hpp"
+#include "tyr/common/declarations.hpp"
+#include "tyr/common/hash.hpp"
+#include "tyr/common/variant.hpp"
+#include "tyr/formalism/planning/repository.hpp"
+#include "tyr/formalism/planning/views.hpp"
+#include "tyr/planning/ground_task.hpp"
+#include "tyr/planning/ground_task/state_view.hpp"
+#include "tyr/planning/lifted_task.hpp"
+#include "tyr/planning/lifted_task/state_view.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <numeric>
+#include <ranges>
+#include <span>
+#include <tuple>
+
+namespace f = tyr::formalism;
+namespace fp = tyr::formalism::planning;
+
+namespace tyr::planning
+{
+
+/**
+ * Hypergraph
+ */
+
+using Edge = std::vector<uint_t>;
+
+static size_t get_objects_begin(std::span<const uint_t> edge) noexcept { return 1 + edge[0]; }
+
+void ObjectHypergraph::clear(size_t num_objects)
+{
+    data.clear();
+    offsets.assign(1, 0);
+    incident_edges.resize(num_objects);
+    for (auto& incident : incident_edges)
+        incident.clear();
+}
+
+void ObjectHypergraph::add_edge(std::span<const uint_t> edge)
+{
+    const auto edge_index = uint_t(get_num_edges());
+    for (auto i = get_objects_begin(edge); i < edge.size(); ++i)
+    {
+        auto& incident = incident_edges[edge[i]];
+        if (incident.empty() || incident.back() != edge_index)
+            incident.push_back(edge_index);
+    }
+    data.insert(data.end(), edge.begin(), edge.end());
+    offsets.push_back(uint_t(data.size()));
+}
+
+static void sort_edges(const ObjectHypergraph& graph, std::vector<uint_t>& order)
+{
+    order.resize(graph.get_num_edges());
+    std::iota(order.begin(), order.end(), uint_t(0));
+    std::sort(order.begin(),
+              order.end(),
+              [&](auto lhs, auto rhs) { return std::ranges::lexicographical_compare(graph.get_edge(lhs), graph.get_edge(rhs)); });
+}
+
+/// @brief Refine the colors until the number of colors is stable.
+///
+/// New colors are the ranks of the sorted signatures, which makes them invariant under permutations of the objects.
+static void refine_colors(const ObjectHypergraph& graph, std::vector<uint_t>& colors, ObjectSymmetriesWorkspace& workspace)
+{
+    const auto num_objects = colors.size();
+
+    auto& signatures = workspace.signatures;
+    auto& occurrence_data = workspace.occurrence_data;
+    auto& occurrence_offsets = workspace.occurrence_offsets;
+    auto& occurrence_order = workspace.occurrence_order;
+    auto& order = workspace.order;
+
+    signatures.resize(num_objects);
+    order.resize(num_objects);
+
+    auto count_colors = [&]
+    {
+        auto& sorted = workspace.sorted_colors;
+        sorted.assign(colors.begin(), colors.end());
+        std::sort(sorted.begin(), sorted.end());
+        return size_t(std::unique(sorted.begin(), sorted.end()) - sorted.begin());
+    };
+
+    auto get_occurrence = [&](uint_t index)
+    { return std::span<const uint_t>(occurrence_data.data() + occurrence_offsets[index], occurrence_data.data() + occurrence_offsets[index + 1]); };
+
+    auto num_colors = count_colors();
+
+    while (true)
+    {
+        for (uint_t object = 0; object < num_objects; ++object)
+        {
+            /* Each occurrence is [header, position, colors of the objects] of an incident edge. */
+
+            occurrence_data.clear();
+            occurrence_offsets.assign(1, 0);
+            for (const auto edge_index : graph.incident_edges[object])
+            {
+                const auto edge = graph.get_edge(edge_index);
+                const auto objects_begin = get_objects_begin(edge);
+                for (auto i = objects_begin; i < edge.size(); ++i)
+                {
+                    if (edge[i] != object)
+                        continue;
+
+                    occurrence_data.insert(occurrence_data.end(), edge.begin(), edge.begin() + objects_begin);
+                    occurrence_data.push_back(uint_t(i - objects_begin));
+                    for (auto j = objects_begin; j < edge.size(); ++j)
+                        occurrence_data.push_back(colors[edge[j]]);
+                    occurrence_offsets.push_back(uint_t(occurrence_data.size()));
+                }
+            }
+
+            occurrence_order.resize(occurrence_offsets.size() - 1);
+            std::iota(occurrence_order.begin(), occurrence_order.end(), uint_t(0));
+            std::sort(occurrence_order.begin(),
+                      occurrence_order.end(),
+                      [&](auto lhs, auto rhs) { return std::ranges::lexicographical_compare(get_occurrence(lhs), get_occurrence(rhs)); });
+
+            auto& signature = signatures[object];
+            signature.clear();
+            signature.push_back(colors[object]);
+            for (const auto index : occurrence_order)
+            {
+                const auto occurrence = get_occurrence(index);
+                signature.push_back(uint_t(occurrence.size()));
+                signature.insert(signature.end(), occurrence.begin(), occurrence.end());
+            }
+        }
+
+        std::iota(order.begin(), order.end(), uint_t(0));
+        std::sort(order.begin(), order.end(), [&](auto lhs, auto rhs) { return signatures[lhs] < signatures[rhs]; });
+
+        auto new_num_colors = size_t(0);
+        for (size_t i = 0; i < num_objects; ++i)
+        {
+            if (i == 0 || signatures[order[i]] != signatures[order[i - 1]])
+                ++new_num_colors;
+            colors[order[i]] = uint_t(new_num_colors - 1);
+        }
+
+        if (new_num_colors == num_colors)
+            return;
+        num_colors = new_num_colors;
+    }
+}
+
+/// @brief Return true iff swapping the objects `a` and `b` maps the hypergraph onto itself.
+static bool is_transposition_automorphism(const ObjectHypergraph& graph, const UnorderedSet<Edge>& edge_set, uint_t a, uint_t b, Edge& buffer)
+{
+    for (const auto object : { a, b })
+    {
+        for (const auto edge_index : graph.incident_edges[object])
+        {
+            const auto edge = graph.get_edge(edge_index);
+            buffer.assign(edge.begin(), edge.end());
+            for (auto i = get_objects_begin(edge); i < buffer.size(); ++i)
+                buffer[i] = (buffer[i] == a) ? b : (buffer[i] == b) ? a : buffer[i];
+            if (!edge_set.contains(buffer))
+                return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Fixed objects
+ */
+
+using ObjectSet = UnorderedSet<uint_t>;
+
+static void collect_objects(float_t element, ObjectSet& objects);
+
+template<f::OpKind O, typename T>
+static void collect_objects(fp::UnaryOperatorView<O, T> element, ObjectSet& objects);
+
+template<f::OpKind O, typename T>
+static void collect_objects(fp::BinaryOperatorView<O, T> element, ObjectSet& objects);
+
+template<f::OpKind O, typename T>
+static void collect_objects(fp::MultiOperatorView<O, T> element, ObjectSet& objects);
+
+template<typename T>
+static void collect_objects(fp::ArithmeticOperatorView<T> element, ObjectSet& objects);
+
+template<typename T>
+static void collect_objects(fp::BooleanOperatorView<T> element, ObjectSet& objects);
+
+static void collect_objects(fp::FunctionExpressionView element, ObjectSet& objects);
+
+static void collect_objects(fp::GroundFunctionExpressionView element, ObjectSet& objects);
+
+static void collect_objects(fp::TermView element, ObjectSet& objects);
+
+template<f::FactKind T>
+static void collect_objects(fp::FunctionTermView<T> element, ObjectSet& objects);
+
+template<f::FactKind T>
+static void collect_objects(fp::GroundFunctionTermView<T> element, ObjectSet& objects);
+
+template<f::FactKind T>
+static void collect_objects(fp::AtomView<T> element, ObjectSet& objects);
+
+static void collect_objects(float_t element, ObjectSet& objects) {}
+
+template<f::OpKind O, typename T>
+static void collect_objects(fp::UnaryOperatorView<O, T> element, ObjectSet& objects)
+{
+    collect_objects(element.get_arg(), objects);
+}
+
+template<f::OpKind O, typename T>
+static void collect_objects(fp::BinaryOperatorView<O, T> element, ObjectSet& objects)
+{
+    collect_objects(element.get_lhs(), objects);
+    collect_objects(element.get_rhs(), objects);
+}
+
+template<f::OpKind O, typename T>
+static void collect_objects(fp::MultiOperatorView<O, T> element, ObjectSet& objects)
+{
+    for (const auto arg : element.get_args())
+        collect_objects(arg, objects);
+}
+
+template<typename T>
+static void collect_objects(fp::ArithmeticOperatorView<T> element, ObjectSet& objects)
+{
+    visit([&](auto&& arg) { collect_objects(arg, objects); }, element.get_variant());
+}
+
+template<typename T>
+static void collect_objects(fp::BooleanOperatorView<T> element, ObjectSet& objects)
+{
+    visit([&](auto&& arg) { collect_objects(arg, objects); }, element.get_variant());
+}
+
+static void collect_objects(fp::FunctionExpressionView element, ObjectSet& objects)
+{
+    visit([&](auto&& arg) { collect_objects(arg, objects); }, element.get_variant());
+}
+
+static void collect_objects(fp::GroundFunctionExpressionView element, ObjectSet& objects)
+{
+    visit([&](auto&& arg) { collect_objects(arg, objects); }, element.get_variant());
+}
+
+static void collect_objects(fp::TermView element, ObjectSet& objects)
+{
+    visit(
+        [&](auto&& arg)
+        {
+            using Alternative = std::decay_t<decltype(arg)>;
+
+            if constexpr (std::is_same_v<Alternative, fp::ObjectView>)
+                objects.insert(uint_t(arg.get_index()));
+            else if constexpr (std::is_same_v<Alternative, f::ParameterIndex>) {}
+            else
+                static_assert(dependent_false<Alternative>::value, "Missing case");
+        },
+        element.get_variant());
+}
+
+template<f::FactKind T>
+static void collect_objects(fp::FunctionTermView<T> element, ObjectSet& objects)
+{
+    for (const auto term : element.get_terms())
+        collect_objects(term, objects);
+}
+
+template<f::FactKind T>
+static void collect_objects(fp::GroundFunctionTermView<T> element, ObjectSet& objects)
+{
+    for (const auto object : element.get_row().get_objects())
+        objects.insert(uint_t(object.get_index()));
+}
+
+template<f::FactKind T>
+static void collect_objects(fp::AtomView<T> element, ObjectSet& objects)
+{
+    for (const auto term : element.get_terms())
+        collect_objects(term, objects);
+}
+
+/// @brief Collect the objects that every symmetry must fix because they are referred to by name.
+template<typename TaskView>
+static ObjectSet collect_fixed_objects(TaskView task)
+{
+    auto objects = ObjectSet {};
+
+    for (const auto object : task.get_domain().get_constants())
+        objects.insert(uint_t(object.get_index()));
+
+    for (const auto constraint : task.get_goal().get_numeric_constraints())
+        collect_objects(constraint, objects);
+
+    if (task.get_metric())
+        collect_objects(task.get_metric().value().get_fexpr(), objects);
+
+    for (const auto axiom : task.get_axioms())
+    {
+        const auto body = axiom.get_body();
+
+        for (const auto literal : body.template get_literals<f::StaticTag>())
+            collect_objects(literal.get_atom(), objects);
+        for (const auto literal : body.template get_literals<f::FluentTag>())
+            collect_objects(literal.get_atom(), objects);
+        for (const auto literal : body.template get_literals<f::DerivedTag>())
+            collect_objects(literal.get_atom(), objects);
+        for (const auto constraint : body.get_numeric_constraints())
+            collect_objects(constraint, objects);
+
+        collect_objects(axiom.get_head(), objects);
+    }
+
+    return objects;
+}
+
+/**
+ * ObjectSymmetries
+ */
+
+template<typename GroundAtomView>
+static Edge make_atom_edge(uint_t label, GroundAtomView atom)
+{
+    auto edge = Edge { 1, label };
+    for (const auto object : atom.get_row().get_objects())
+        edge.push_back(uint_t(object.get_index()));
+    return edge;
+}
+
+template<typename Task>
+ObjectSymmetries::ObjectSymmetries(const Task& task) : m_classes(), m_colors()
+{
+    const auto task_view = task.get_task();
+
+    auto num_objects = size_t(0);
+    for (const auto object : task_view.get_objects())
+        num_objects = std::max(num_objects, size_t(uint_t(object.get_index())) + 1);
+    for (const auto object : task_view.get_domain().get_constants())
+        num_objects = std::max(num_objects, size_t(uint_t(object.get_index())) + 1);
+
+    const auto fixed_objects = collect_fixed_objects(task_view);
+
+    /* Build the hypergraph over the static atoms, the static function values, and the goal. */
+
+    auto labels = UnorderedMap<std::tuple<uint_t, uint_t, uint_t, uint_t>, uint_t> {};
+    auto get_label = [&](uint_t kind, uint_t symbol, uint_t lo = 0, uint_t hi = 0)
+    { return labels.emplace(std::make_tuple(kind, symbol, lo, hi), uint_t(labels.size())).first->second; };
+
+    auto graph = ObjectHypergraph();
+    graph.clear(num_objects);
+
+    auto edge_set = UnorderedSet<Edge> {};
+    auto add_edge = [&](const Edge& edge)
+    {
+        if (edge_set.insert(edge).second)
+            graph.add_edge(edge);
+    };
+
+    for (const auto atom : task_view.template get_atoms<f::StaticTag>())
+        add_edge(make_atom_edge(get_label(0, uint_t(atom.get_predicate().get_index())), atom));
+
+    for (const auto fterm_value : task_view.template get_fterm_values<f::StaticTag>())
+    {
+        const auto fterm = fterm_value.get_fterm();
+        const auto bits = std::bit_cast<uint64_t>(fterm_value.get_value());
+        auto edge = Edge { 1, get_label(1, uint_t(fterm.get_function().get_index()), uint_t(bits), uint_t(bits >> 32)) };
+        for (const auto object : fterm.get_row().get_objects())
+            edge.push_back(uint_t(object.get_index()));
+        add_edge(edge);
+    }
+
+    const auto goal = task_view.get_goal();
+
+    for (const auto literal : goal.template get_facts<f::StaticTag>())
+    {
+        const auto atom = literal.get_atom();
+        add_edge(make_atom_edge(get_label(2, uint_t(atom.get_predicate().get_index()), literal.get_polarity()), atom));
+    }
+
+    for (const auto fact : goal.template get_facts<f::FluentTag>())
+    {
+        // The goal fixes the value of the variable, i.e., it requires the atom of the value and forbids all other atoms of the variable.
+        const auto atoms = fact.get_variable().get_atoms();
+        for (uint_t i = 0; i < atoms.size(); ++i)
+        {
+            const auto atom = atoms[i];
+            const auto is_true = uint_t(i + 1 == uint_t(fact.get_value()));
+            add_edge(make_atom_edge(get_label(3, uint_t(atom.get_predicate().get_index()), is_true), atom));
+        }
+    }
+
+    for (const auto literal : goal.template get_facts<f::DerivedTag>())
+    {
+        const auto atom = literal.get_atom();
+        add_edge(make_atom_edge(get_label(4, uint_t(atom.get_predicate().get_index()), literal.get_polarity()), atom));
+    }
+
+    /* Fixed objects and objects outside of the task obtain unique colors, all others start with the same color. */
+
+    auto is_candidate = std::vector<bool>(num_objects, false);
+    for (const auto object : task_view.get_objects())
+        is_candidate[uint_t(object.get_index())] = !fixed_objects.contains(uint_t(object.get_index()));
+
+    m_colors.assign(num_objects, 0);
+    for (uint_t object = 0, color = 1; object < num_objects; ++object)
+        if (!is_candidate[object])
+            m_colors[object] = color++;
+
+    auto workspace = ObjectSymmetriesWorkspace();
+    refine_colors(graph, m_colors, workspace);
+
+    /* Partition each color class into groups of objects whose transpositions are automorphisms.
+       It suffices to test against one member per group, because all transpositions within a group generate its symmetric group. */
+
+    auto color_classes = std::vector<std::vector<uint_t>>(num_objects);
+    for (uint_t object = 0; object < num_objects; ++object)
+        if (is_candidate[object])
+            color_classes[m_colors[object]].push_back(object);
+
+    auto buffer = Edge {};
+    for (const auto& color_class : color_classes)
+    {
+        auto groups = std::vector<std::vector<uint_t>> {};
+        for (const auto object : color_class)
+        {
+            auto it = std::find_if(groups.begin(),
+                                   groups.end(),
+                                   [&](const auto& group) { return is_transposition_automorphism(graph, edge_set, group.front(), object, buffer); });
+            if (it != groups.end())
+                it->push_back(object);
+            else
+                groups.push_back({ object });
+        }
+
+        for (const auto& group : groups)
+        {
+            if (group.size() < 2)
+                continue;
+
+            auto& objects = m_classes.emplace_back();
+            for (const auto object : group)
+                objects.push_back(Index<f::Object>(object));
+        }
+    }
+}
+
+template ObjectSymmetries::ObjectSymmetries(const LiftedTask& task);
+template ObjectSymmetries::ObjectSymmetries(const GroundTask& task);
+
+size_t ObjectSymmetries::get_num_generators() const noexcept
+{
+    auto result = size_t(0);
+    for (const auto& objects : m_classes)
+        result += objects.size() - 1;
+    return result;
+}
+
+template<typename Task>
+void ObjectSymmetries::compute_state_key(const StateView<Task>& state, ObjectSymmetriesWorkspace& workspace, std::vector<uint_t>& out_key) const
+{
+    const auto num_objects = m_colors.size();
+
+    /* Collect the fluent atoms and the fluent function values of the state.
+       Derived atoms are omitted since they are determined by the fluent ones. */
+
+    auto& graph = workspace.graph;
+    auto& edge = workspace.edge;
+    graph.clear(num_objects);
+
+    for (const auto fact : state.get_fluent_facts_view())
+    {
+        if (const auto atom = fact.get_atom())
+        {
+            edge.assign({ 2, 0, uint_t(atom->get_predicate().get_index()) });
+            for (const auto object : atom->get_row().get_objects())
+                edge.push_back(uint_t(object.get_index()));
+            graph.add_edge(edge);
+        }
+    }
+
+    for (const auto& [fterm, value] : state.get_fluent_fterm_values_view())
+    {
+        const auto bits = std::bit_cast<uint64_t>(value);
+        edge.assign({ 4, 1, uint_t(fterm.get_function().get_index()), uint_t(bits), uint_t(bits >> 32) });
+        for (const auto object : fterm.get_row().get_objects())
+            edge.push_back(uint_t(object.get_index()));
+        graph.add_edge(edge);
+    }
+
+    /* Map the objects of each class, ordered by their refined colors, onto the objects of the class, ordered by index. */
+
+    auto& colors = workspace.colors;
+    colors.assign(m_colors.begin(), m_colors.end());
+    refine_colors(graph, colors, workspace);
+
+    auto& permutation = workspace.permutation;
+    permutation.resize(num_objects);
+    std::iota(permutation.begin(), permutation.end(), uint_t(0));
+
+    auto& members = workspace.members;
+    for (const auto& objects : m_classes)
+    {
+        members.clear();
+        for (const auto object : objects)
+            members.push_back(uint_t(object));
+        std::stable_sort(members.begin(), members.end(), [&](auto lhs, auto rhs) { return colors[lhs] < colors[rhs]; });
+
+        for (size_t i = 0; i < members.size(); ++i)
+            permutation[members[i]] = uint_t(objects[i]);
+    }
+
+    /* Apply the permutation in place, the incident edges are stale afterwards. */
+
+    for (size_t edge_index = 0; edge_index < graph.get_num_edges(); ++edge_index)
+        for (auto i = graph.offsets[edge_index] + get_objects_begin(graph.get_edge(edge_index)); i < graph.offsets[edge_index + 1]; ++i)
+            graph.data[i] = permutation[graph.data[i]];
+
+    auto& order = workspace.order;
+    sort_edges(graph, order);
+
+    out_key.clear();
+    out_key.push_back(uint_t(graph.get_num_edges()));
+    for (const auto edge_index : order)
+    {
+        const auto sorted_edge = graph.get_edge(edge_index);
+        out_key.push_back(uint_t(sorted_edge.size()));
+        out_key.insert(out_key.end(), sorted_edge.begin(), sorted_edge.end());
+    }
+}
+
+template void ObjectSymmetries::compute_state_key(const StateView<LiftedTask>& state, ObjectSymmetriesWorkspace& workspace, std::vector<uint_t>& out_key) const;
+template void ObjectSymmetries::compute_state_key(const StateView<GroundTask>& state, ObjectSymmetriesWorkspace& workspace, std::vector<uint_t>& out_key) const;
+}
@@ -25,7 +25,6 @@
 #include "tyr/formalism/datalog/merge.hpp"
 #include "tyr/formalism/datalog/repository.hpp"
 #include "tyr/formalism/datalog/views.hpp"
-#include "tyr/formalism/planning/merge_datalog.hpp"
 #include "tyr/formalism/planning/repository.hpp"
 #include "tyr/formalism/planning/views.hpp"
 #include "tyr/planning/lifted_task/unpacked_state.hpp"
@@ -38,11 +37,12 @@ namespace tyr::planning
 
 void insert_fluent_atoms_to_fact_set(const UnpackedState<LiftedTask>& state,
                                      const formalism::planning::Repository& repository,
+                                     AtomTranslationTable& atom_translation_table,
                                      fp::MergeDatalogContext& merge_context,
                                      datalog::TaggedFactSets<f::FluentTag>& fact_sets)
 {
     for (const auto fact : state.get_fluent_facts_view(repository))
-        fact_sets.predicate.insert(fp::merge_p2d<f::FluentTag, f::FluentTag>(fact.get_atom().value(), merge_context).first);
+        fact_sets.predicate.insert(atom_translation_table.to_datalog(fact.get_atom().value(), merge_context));
 }
 
 }
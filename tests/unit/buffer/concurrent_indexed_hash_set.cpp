@@ -0,0 +1,93 @@
+/*
+ * Copyright (C) 2025 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "tyr/tyr.hpp"
+
+#include <gtest/gtest.h>
+#include <thread>
+
+namespace b = tyr::buffer;
+namespace f = tyr::formalism;
+
+namespace tyr::tests
+{
+
+TEST(TyrTests, TyrBufferConcurrentIndexedHashSet)
+{
+    auto repository = b::ConcurrentIndexedHashSet<f::Predicate<f::FluentTag>>(4);
+    EXPECT_EQ(repository.num_shards(), 4);
+
+    constexpr size_t num_threads = 4;
+    constexpr size_t num_predicates = 1000;
+
+    // Every thread interns the same predicates, in a different order.
+    auto indices = std::vector<std::vector<Index<f::Predicate<f::FluentTag>>>>(num_threads, std::vector<Index<f::Predicate<f::FluentTag>>>(num_predicates));
+    auto threads = std::vector<std::thread> {};
+    for (size_t t = 0; t < num_threads; ++t)
+    {
+        threads.emplace_back(
+            [&, t]
+            {
+                auto builder = Data<f::Predicate<f::FluentTag>>();
+                for (size_t k = 0; k < num_predicates; ++k)
+                {
+                    const auto i = (t % 2 == 0) ? k : num_predicates - 1 - k;
+                    builder.name = "predicate_" + std::to_string(i);
+                    builder.arity = i % 5;
+                    canonicalize(builder);
+                    indices[t][i] = repository.insert(builder).first;
+                }
+            });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    // Each predicate was inserted exactly once and indices are dense.
+    EXPECT_EQ(repository.size(), num_predicates);
+
+    auto seen = std::vector<bool>(num_predicates, false);
+    for (size_t i = 0; i < num_predicates; ++i)
+    {
+        const auto index = indices[0][i];
+        for (size_t t = 1; t < num_threads; ++t)
+            EXPECT_EQ(indices[t][i], index);
+
+        ASSERT_LT(index.value, num_predicates);
+        EXPECT_FALSE(seen[index.value]);
+        seen[index.value] = true;
+
+        const auto& predicate = repository[index];
+        EXPECT_EQ(predicate.name.view(), "predicate_" + std::to_string(i));
+        EXPECT_EQ(predicate.arity, i % 5);
+    }
+
+    // Existing predicates are found, absent ones are not.
+    auto builder = Data<f::Predicate<f::FluentTag>>();
+    builder.name = "predicate_7";
+    builder.arity = 2;
+    canonicalize(builder);
+    EXPECT_EQ(repository.find(builder), indices[0][7]);
+
+    builder.name = "predicate_absent";
+    canonicalize(builder);
+    EXPECT_FALSE(repository.find(builder).has_value());
+
+    repository.clear();
+    EXPECT_TRUE(repository.empty());
+}
+
+}
@@ -0,0 +1,112 @@
+/*
+ * Copyright (C) 2025 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+#include <random>
+#include <set>
+#include <tyr/common/epoch_hash_table.hpp>
+#include <unordered_map>
+
+namespace tyr::tests
+{
+
+TEST(TyrTests, TyrCommonEpochHashSet)
+{
+    auto set = EpochHashSet<uint64_t>();
+    EXPECT_TRUE(set.empty());
+    EXPECT_FALSE(set.contains(0));
+
+    for (uint64_t i = 0; i < 1000; ++i)
+        EXPECT_TRUE(set.insert(i * 7).second);
+    for (uint64_t i = 0; i < 1000; ++i)
+        EXPECT_FALSE(set.insert(i * 7).second);
+
+    EXPECT_EQ(set.size(), 1000);
+    EXPECT_TRUE(set.contains(14));
+    EXPECT_FALSE(set.contains(15));
+
+    // Clearing retains the capacity and empties the set.
+    const auto capacity = set.capacity();
+    set.clear();
+    EXPECT_TRUE(set.empty());
+    EXPECT_EQ(set.capacity(), capacity);
+    EXPECT_FALSE(set.contains(14));
+    EXPECT_EQ(set.begin(), set.end());
+
+    EXPECT_TRUE(set.insert(14).second);
+    EXPECT_EQ(*set.begin(), 14);
+}
+
+TEST(TyrTests, TyrCommonEpochHashSetRandomized)
+{
+    auto set = EpochHashSet<uint64_t>();
+    auto expected = std::set<uint64_t> {};
+    auto rng = std::mt19937_64(42);
+
+    for (size_t round = 0; round < 20; ++round)
+    {
+        set.clear();
+        expected.clear();
+
+        for (size_t op = 0; op < 2000; ++op)
+        {
+            const auto key = rng() % 512;
+            if (rng() % 3 == 0)
+                EXPECT_EQ(set.erase(key), expected.erase(key));
+            else
+                EXPECT_EQ(set.insert(key).second, expected.insert(key).second);
+        }
+
+        EXPECT_EQ(set.size(), expected.size());
+        EXPECT_EQ(std::set<uint64_t>(set.begin(), set.end()), expected);
+        for (uint64_t key = 0; key < 512; ++key)
+            EXPECT_EQ(set.contains(key), expected.contains(key));
+    }
+}
+
+TEST(TyrTests, TyrCommonEpochHashMap)
+{
+    auto map = EpochHashMap<uint64_t, double>();
+    auto expected = std::unordered_map<uint64_t, double> {};
+    auto rng = std::mt19937_64(7);
+
+    for (size_t round = 0; round < 10; ++round)
+    {
+        map.clear();
+        expected.clear();
+
+        for (size_t op = 0; op < 2000; ++op)
+        {
+            const auto key = rng() % 256;
+            const auto value = static_cast<double>(op);
+            if (rng() % 4 == 0)
+                EXPECT_EQ(map.erase(key), expected.erase(key));
+            else
+                EXPECT_EQ(map.insert_or_assign(key, value).second, expected.insert_or_assign(key, value).second);
+        }
+
+        EXPECT_EQ(map.size(), expected.size());
+        for (const auto& [key, value] : expected)
+        {
+            const auto it = map.find(key);
+            ASSERT_NE(it, map.end());
+            EXPECT_EQ(it->second, value);
+        }
+    }
+}
+
+}
@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2025 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+#include <tyr/buffer/segmented_buffer.hpp>
+#include <tyr/common/segment_allocator.hpp>
+#include <tyr/common/segmented_vector.hpp>
+
+namespace tyr::tests
+{
+
+TEST(TyrTests, TyrCommonSegmentAllocatorSegmentedVector)
+{
+    // 1M elements span segments above the huge page threshold.
+    auto vec = SegmentedVector<uint64_t, 32, HugePageAllocator<uint64_t>>();
+    const auto n = size_t(1) << 20;
+    for (size_t i = 0; i < n; ++i)
+        vec.push_back(i * 3);
+
+    EXPECT_EQ(vec.size(), n);
+    for (size_t i = 0; i < n; i += 4097)
+        EXPECT_EQ(vec[i], i * 3);
+    EXPECT_EQ(vec.back(), (n - 1) * 3);
+    EXPECT_GE(vec.memory_usage(), n * sizeof(uint64_t));
+
+    vec.release();
+    EXPECT_TRUE(vec.empty());
+    EXPECT_EQ(vec.capacity(), 0);
+    EXPECT_EQ(vec.memory_usage(), 0);
+
+    vec.push_back(7);
+    EXPECT_EQ(vec.front(), 7);
+}
+
+TEST(TyrTests, TyrCommonSegmentAllocatorExplicitHugePages)
+{
+    // Falls back to transparent huge pages if no huge pages are preallocated.
+    auto allocator = HugePageAllocator<uint8_t, HugePageMode::EXPLICIT>();
+    const auto bytes = 3 * HugePageAllocator<uint8_t>::HUGE_PAGE_SIZE;
+    auto* ptr = allocator.allocate(bytes);
+    ASSERT_NE(ptr, nullptr);
+    ptr[0] = 1;
+    ptr[bytes - 1] = 2;
+    EXPECT_EQ(ptr[0] + ptr[bytes - 1], 3);
+    allocator.deallocate(ptr, bytes);
+}
+
+TEST(TyrTests, TyrCommonSegmentAllocatorSegmentedBuffer)
+{
+    auto arena = buffer::BasicSegmentedBuffer<HugePageAllocator<uint8_t>>();
+    auto data = std::vector<uint8_t>(1 << 16, uint8_t(42));
+
+    auto pointers = std::vector<const uint8_t*> {};
+    for (size_t i = 0; i < 64; ++i)
+        pointers.push_back(arena.write(data.data(), data.size(), 8));
+
+    EXPECT_EQ(arena.size(), 64 * data.size());
+    for (const auto* ptr : pointers)
+    {
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(ptr) % 8, 0);
+        EXPECT_EQ(ptr[0], 42);
+        EXPECT_EQ(ptr[data.size() - 1], 42);
+    }
+
+    arena.release();
+    EXPECT_EQ(arena.size(), 0);
+    EXPECT_EQ(arena.capacity(), 0);
+}
+
+}
@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2025 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+#include <sstream>
+#include <thread>
+#include <tyr/common/trace.hpp>
+
+namespace tyr::tests
+{
+
+TEST(TyrTests, TyrCommonTraceThreadBuffer)
+{
+    auto buffer = trace::ThreadBuffer(0, 3);
+
+    for (uint64_t i = 0; i < 5; ++i)
+        buffer.push_back(trace::Event { "event", "test", int64_t(i), i, i + 1 });
+
+    // Only the 3 newest events are kept, in order.
+    EXPECT_EQ(buffer.size(), 3);
+    auto args = std::vector<int64_t> {};
+    buffer.for_each([&](const trace::Event& event) { args.push_back(event.arg); });
+    EXPECT_EQ(args, (std::vector<int64_t> { 2, 3, 4 }));
+
+    buffer.clear();
+    EXPECT_EQ(buffer.size(), 0);
+}
+
+TEST(TyrTests, TyrCommonTraceTracer)
+{
+    auto& tracer = trace::Tracer::instance();
+    tracer.clear();
+
+    // Disabled tracers record nothing.
+    {
+        const auto scope = trace::TraceScope("disabled", "test");
+    }
+    EXPECT_EQ(tracer.get_num_events(), 0);
+
+    tracer.enable();
+
+    {
+        const auto scope = trace::TraceScope("main", "test", 7);
+    }
+    auto worker = std::thread([] { const auto scope = trace::TraceScope("worker", "test"); });
+    worker.join();
+
+    tracer.disable();
+
+    EXPECT_EQ(tracer.get_num_events(), 2);
+
+    auto out = std::stringstream();
+    tracer.write_chrome_trace(out);
+    const auto json = out.str();
+
+    EXPECT_NE(json.find("\"traceEvents\""), std::string::npos);
+    EXPECT_NE(json.find("\"name\":\"main\",\"cat\":\"test\",\"ph\":\"X\""), std::string::npos);
+    EXPECT_NE(json.find("\"name\":\"worker\""), std::string::npos);
+    EXPECT_NE(json.find("\"args\":{\"index\":7}"), std::string::npos);
+    EXPECT_EQ(json.find("\"name\":\"disabled\""), std::string::npos);
+
+    tracer.clear();
+    EXPECT_EQ(tracer.get_num_events(), 0);
+}
+
+}
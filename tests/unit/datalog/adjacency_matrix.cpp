@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2025 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "tyr/datalog/delta_kpkc_graph.hpp"
+
+#include <gtest/gtest.h>
+
+namespace d = tyr::datalog;
+
+namespace tyr::tests
+{
+
+TEST(TyrTests, TyrDatalogDeduplicatedAdjacencyMatrixHybrid)
+{
+    // Partition 0 has two vertices, partition 1 has 200 vertices.
+    auto vertex_partitions = std::vector<std::vector<uint_t>>(2);
+    for (uint_t v = 0; v < 202; ++v)
+        vertex_partitions[v < 2 ? 0 : 1].push_back(v);
+
+    const auto layout = d::kpkc::GraphLayout(202, vertex_partitions);
+    auto matrix = d::kpkc::AdjacencyMatrix(layout);
+
+    // Vertex 0 is adjacent to all of partition 1, vertex 1 only to two vertices.
+    for (uint_t b = 0; b < 200; ++b)
+        matrix.get_bitset(0, 1).set(b);
+    matrix.get_bitset(1, 1).set(7);
+    matrix.get_bitset(1, 1).set(150);
+
+    const auto dedup = d::kpkc::DeduplicatedAdjacencyMatrix(matrix);
+
+    EXPECT_TRUE(dedup.get_cell(0, 1).is_dense());
+    EXPECT_FALSE(dedup.get_cell(1, 1).is_dense());
+    EXPECT_EQ(dedup.sparse_data().size(), 2);
+
+    for (uint_t v = 0; v < 2; ++v)
+        for (uint_t b = 0; b < 200; ++b)
+            EXPECT_EQ(dedup.test(v, 1, b), matrix.get_bitset(v, 1).test(b));
+
+    // Filtered enumeration agrees for both representations.
+    auto include_blocks = std::vector<uint64_t>(layout.info.infos[1].num_blocks, 0);
+    auto exclude_blocks = std::vector<uint64_t>(layout.info.infos[1].num_blocks, 0);
+    auto include = BitsetSpan<uint64_t>(include_blocks.data(), 200);
+    auto exclude = BitsetSpan<uint64_t>(exclude_blocks.data(), 200);
+    include.set(7);
+    include.set(150);
+    include.set(199);
+    exclude.set(150);
+
+    for (uint_t v = 0; v < 2; ++v)
+    {
+        auto bits = std::vector<size_t> {};
+        dedup.for_each_bit(v, 1, [&](auto&& bit) { bits.push_back(bit); }, include, exclude);
+
+        EXPECT_EQ(bits, (v == 0) ? (std::vector<size_t> { 7, 199 }) : (std::vector<size_t> { 7 }));
+    }
+}
+
+}
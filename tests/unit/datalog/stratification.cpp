@@ -0,0 +1,157 @@
+/*
+ * Copyright (C) 2025 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <tyr/datalog/bottom_up.hpp>
+#include <tyr/datalog/datalog.hpp>
+#include <tyr/formalism/formalism.hpp>
+#include <tyr/planning/planning.hpp>
+
+namespace d = tyr::datalog;
+namespace p = tyr::planning;
+namespace f = tyr::formalism;
+namespace fd = tyr::formalism::datalog;
+namespace fp = tyr::formalism::planning;
+
+namespace tyr::tests
+{
+
+static p::LiftedTaskPtr compute_lifted_task(const fs::path& domain_filepath, const fs::path& problem_filepath)
+{
+    return p::LiftedTask::create(fp::Parser(domain_filepath).parse_task(problem_filepath));
+}
+
+static fs::path absolute(const std::string& subdir) { return fs::path(std::string(DATA_DIR)) / subdir; }
+
+/// @brief Check that the components partition the rules and that each component depends exactly on the components
+/// whose head predicates occur in its rule bodies.
+static void check_dependencies(const d::ProgramContext& context)
+{
+    const auto& strata = context.get_strata();
+    const auto& repository = context.get_program_repository();
+
+    ASSERT_EQ(strata.dependencies.size(), strata.components.size());
+    EXPECT_EQ(context.get_listeners().components.size(), strata.components.size());
+
+    auto head_component = UnorderedMap<Index<f::Predicate<f::FluentTag>>, uint_t> {};
+    auto num_rules = size_t(0);
+    for (uint_t i = 0; i < strata.components.size(); ++i)
+    {
+        EXPECT_FALSE(strata.components[i].empty());
+        num_rules += strata.components[i].size();
+
+        for (const auto rule : strata.components[i])
+        {
+            EXPECT_EQ(head_component.emplace(make_view(rule, repository).get_head().get_predicate().get_index(), i).first->second, i);
+        }
+    }
+    EXPECT_EQ(num_rules, context.get_program().get_rules().size());
+
+    for (uint_t i = 0; i < strata.components.size(); ++i)
+    {
+        auto expected = std::vector<uint_t> {};
+        for (const auto rule : strata.components[i])
+            for (const auto literal : make_view(rule, repository).get_body().get_literals<f::FluentTag>())
+                if (const auto it = head_component.find(literal.get_atom().get_predicate().get_index()); it != head_component.end() && it->second != i)
+                    expected.push_back(it->second);
+
+        std::sort(expected.begin(), expected.end());
+        expected.erase(std::unique(expected.begin(), expected.end()), expected.end());
+
+        EXPECT_EQ(strata.dependencies[i], expected);
+
+        // The components are in topological order.
+        for (const auto j : strata.dependencies[i])
+            EXPECT_LT(j, i);
+    }
+}
+
+static std::vector<std::string> solve_bottom_up(p::GroundTaskProgram& program, bool concurrent_strata)
+{
+    const auto& const_workspace = program.get_const_program_workspace();
+
+    auto workspace = d::ProgramWorkspace<d::NoOrAnnotationPolicy, d::NoAndAnnotationPolicy, d::NoTerminationPolicy>(program.get_program_context(),
+                                                                                                                    const_workspace,
+                                                                                                                    d::NoOrAnnotationPolicy(),
+                                                                                                                    d::NoAndAnnotationPolicy(),
+                                                                                                                    d::NoTerminationPolicy(),
+                                                                                                                    concurrent_strata);
+
+    auto ctx = d::ProgramExecutionContext(workspace, const_workspace);
+    ctx.clear();
+
+    d::solve_bottom_up(ctx);
+
+    auto facts = std::vector<std::string> {};
+    for (const auto& set : workspace.facts.fact_sets.predicate.get_sets())
+        for (const auto binding : set.get_bindings())
+            facts.push_back(to_string(binding));
+
+    std::sort(facts.begin(), facts.end());
+
+    return facts;
+}
+
+static void check_fixpoint(const fs::path& domain_filepath, const fs::path& problem_filepath)
+{
+    auto lifted_task = compute_lifted_task(domain_filepath, problem_filepath);
+
+    auto program = p::GroundTaskProgram(lifted_task->get_task());
+
+    check_dependencies(program.get_program_context());
+
+    const auto sequential_facts = solve_bottom_up(program, false);
+    const auto concurrent_facts = solve_bottom_up(program, true);
+
+    EXPECT_FALSE(sequential_facts.empty());
+    EXPECT_EQ(concurrent_facts, sequential_facts);
+}
+
+TEST(TyrTests, TyrDatalogStratificationGripper) { check_fixpoint(absolute("gripper/domain.pddl"), absolute("gripper/test_problem.pddl")); }
+
+TEST(TyrTests, TyrDatalogStratificationPhilosophers)
+{
+    check_fixpoint(absolute("philosophers/domain.pddl"), absolute("philosophers/test_problem.pddl"));
+}
+
+TEST(TyrTests, TyrDatalogStratificationPsrMiddle) { check_fixpoint(absolute("psr-middle/domain.pddl"), absolute("psr-middle/test_problem.pddl")); }
+
+TEST(TyrTests, TyrDatalogStratificationAxiomProgram)
+{
+    auto lifted_task = compute_lifted_task(absolute("psr-middle/domain.pddl"), absolute("psr-middle/test_problem.pddl"));
+
+    check_dependencies(lifted_task->get_axiom_program().get_program_context());
+}
+
+TEST(TyrTests, TyrDatalogStratificationRejectsConcurrentCosts)
+{
+    auto lifted_task = compute_lifted_task(absolute("gripper/domain.pddl"), absolute("gripper/test_problem.pddl"));
+
+    auto& program = lifted_task->get_rpg_program();
+
+    EXPECT_THROW((d::ProgramWorkspace<d::OrAnnotationPolicy, d::AndAnnotationPolicy<d::SumAggregation>, d::NoTerminationPolicy>(
+                     program.get_program_context(),
+                     program.get_const_program_workspace(),
+                     d::OrAnnotationPolicy(),
+                     d::AndAnnotationPolicy<d::SumAggregation>(),
+                     d::NoTerminationPolicy(),
+                     true)),
+                 std::runtime_error);
+}
+
+}
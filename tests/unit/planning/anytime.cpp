@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2025 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+#include <tyr/formalism/formalism.hpp>
+#include <tyr/planning/planning.hpp>
+
+namespace p = tyr::planning;
+namespace fp = tyr::formalism::planning;
+
+namespace tyr::tests
+{
+
+static fs::path absolute(const std::string& subdir) { return fs::path(std::string(DATA_DIR)) / subdir; }
+
+/// @brief Records the cost of every improved plan.
+class ImprovedPlanEventHandler : public p::anytime::EventHandler<p::LiftedTask>
+{
+private:
+    std::vector<float_t> m_costs;
+
+public:
+    void on_expand_node(const p::Node<p::LiftedTask>&) override {}
+    void on_expand_goal_node(const p::Node<p::LiftedTask>&) override {}
+    void on_generate_node(const p::LabeledNode<p::LiftedTask>&) override {}
+    void on_prune_node(const p::Node<p::LiftedTask>&) override {}
+    void on_start_search(const p::Node<p::LiftedTask>&, float_t) override {}
+    void on_start_iteration(float_t) override {}
+    void on_improved_plan(const p::Plan<p::LiftedTask>& plan) override { m_costs.push_back(plan.get_cost()); }
+    void on_end_search() override {}
+    void on_solved(const p::Plan<p::LiftedTask>&) override {}
+    void on_unsolvable() override {}
+    void on_exhausted() override {}
+
+    const std::vector<float_t>& get_costs() const noexcept { return m_costs; }
+};
+
+TEST(TyrTests, TyrPlanningAnytimeGripper)
+{
+    auto lifted_task = p::LiftedTask::create(fp::Parser(absolute("gripper/domain.pddl")).parse_task(absolute("gripper/test_problem.pddl")));
+    auto execution_context = ExecutionContext::create(1);
+
+    // The optimal plan cost.
+    auto astar_successor_generator = p::SuccessorGenerator<p::LiftedTask>(lifted_task, execution_context);
+    auto blind_heuristic = p::BlindHeuristic<p::LiftedTask>::create();
+    const auto astar_result = p::astar_eager::find_solution(*lifted_task, astar_successor_generator, *blind_heuristic);
+    ASSERT_EQ(astar_result.status, p::SearchStatus::SOLVED);
+
+    auto successor_generator = p::SuccessorGenerator<p::LiftedTask>(lifted_task, execution_context);
+    auto ff_heuristic = p::FFRPGHeuristic<p::LiftedTask>::create(lifted_task, execution_context);
+    auto event_handler = std::make_shared<ImprovedPlanEventHandler>();
+
+    // Each iteration either finds a cheaper plan or exhausts its open list, so enough unit cost iterations prove optimality.
+    auto options = p::anytime::Options<p::LiftedTask>();
+    options.event_handler = event_handler;
+    options.weights = std::vector<float_t>(64, 1);
+    options.weights.front() = std::numeric_limits<float_t>::infinity();
+
+    const auto result = p::anytime::find_solution(*lifted_task, successor_generator, *ff_heuristic, options);
+
+    ASSERT_EQ(result.status, p::SearchStatus::SOLVED);
+
+    // Every reported plan is cheaper than the previous one, and the last one is the returned plan.
+    const auto& costs = event_handler->get_costs();
+    ASSERT_FALSE(costs.empty());
+    for (size_t i = 1; i < costs.size(); ++i)
+        EXPECT_LT(costs[i], costs[i - 1]);
+    EXPECT_EQ(costs.back(), result.plan->get_cost());
+
+    // The last iteration exhausted its open list without a cheaper plan.
+    EXPECT_EQ(result.plan->get_cost(), astar_result.plan->get_cost());
+}
+
+}
@@ -16,6 +16,7 @@
  */
 
 #include <gtest/gtest.h>
+#include <random>
 #include <tyr/formalism/formalism.hpp>
 #include <tyr/planning/planning.hpp>
 
@@ -39,6 +40,14 @@ static p::SuccessorGenerator<p::GroundTask> create_successor_generator(std::shar
 
 static fs::path absolute(const std::string& subdir) { return fs::path(std::string(DATA_DIR)) / subdir; }
 
+static p::SearchResult<p::GroundTask> find_solution(std::shared_ptr<p::GroundTask> task)
+{
+    auto successor_generator = create_successor_generator(task);
+    auto blind_heuristic = p::BlindHeuristic<p::GroundTask>::create();
+
+    return p::astar_eager::find_solution(*task, successor_generator, *blind_heuristic, p::astar_eager::Options<p::GroundTask>());
+}
+
 TEST(TyrTests, TyrPlanningGroundTaskAgricola)
 {
     auto ground_task = compute_ground_task(absolute("agricola/domain.pddl"), absolute("agricola/test_problem.pddl"));
@@ -542,4 +551,40 @@ TEST(TyrTests, TyrPlanningGroundTaskZenotravel)
 
     EXPECT_EQ(successor_generator.get_labeled_successor_nodes(successor_generator.get_initial_node()).size(), 7);
 }
+
+TEST(TyrTests, TyrPlanningGroundTaskSnapshot)
+{
+    auto ground_task = compute_ground_task(absolute("gripper/domain.pddl"), absolute("gripper/test_problem.pddl"));
+
+    // A unique name keeps concurrent test runs from reading each other's snapshots.
+    const auto snapshot_filepath = fs::temp_directory_path() / ("tyr_ground_task_gripper_" + std::to_string(std::random_device {}()) + ".snapshot");
+    ground_task->save(snapshot_filepath);
+
+    {
+        auto loaded_task = p::GroundTask::load_mmap(snapshot_filepath);
+
+        EXPECT_EQ(loaded_task->get_num_atoms<f::FluentTag>(), ground_task->get_num_atoms<f::FluentTag>());
+        EXPECT_EQ(loaded_task->get_num_atoms<f::DerivedTag>(), ground_task->get_num_atoms<f::DerivedTag>());
+        EXPECT_EQ(loaded_task->get_num_actions(), ground_task->get_num_actions());
+        EXPECT_EQ(loaded_task->get_num_axioms(), ground_task->get_num_axioms());
+
+        auto successor_generator = create_successor_generator(loaded_task);
+
+        EXPECT_EQ(successor_generator.get_labeled_successor_nodes(successor_generator.get_initial_node()).size(), 6);
+
+        // The reloaded task must produce the same plan, action names included.
+        const auto result = find_solution(ground_task);
+        const auto loaded_result = find_solution(loaded_task);
+
+        EXPECT_EQ(result.status, p::SearchStatus::SOLVED);
+        EXPECT_EQ(loaded_result.status, p::SearchStatus::SOLVED);
+        if (result.plan && loaded_result.plan)
+        {
+            EXPECT_EQ(loaded_result.plan->get_cost(), result.plan->get_cost());
+            EXPECT_EQ(to_string(*loaded_result.plan), to_string(*result.plan));
+        }
+    }
+
+    fs::remove(snapshot_filepath);
+}
 }
\ No newline at end of file
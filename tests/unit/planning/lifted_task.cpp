@@ -15,11 +15,15 @@
  * along with this program. If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
+#include <cmath>
 #include <gtest/gtest.h>
 #include <tyr/formalism/formalism.hpp>
 #include <tyr/planning/planning.hpp>
 
 namespace p = tyr::planning;
+namespace f = tyr::formalism;
+namespace fd = tyr::formalism::datalog;
 namespace fp = tyr::formalism::planning;
 
 namespace tyr::tests
@@ -360,4 +364,150 @@ TEST(TyrTests, TyrPlanningLiftedTaskZenotravel)
 
     EXPECT_EQ(successor_generator.get_labeled_successor_nodes(successor_generator.get_initial_node()).size(), 7);
 }
-}
\ No newline at end of file
+
+TEST(TyrTests, TyrPlanningLiftedTaskStateStoragePolicies)
+{
+    for (const auto storage_policy : { p::StateStoragePolicy::TREE_COMPRESSION, p::StateStoragePolicy::HASH_SET })
+    {
+        auto lifted_task = compute_lifted_task(absolute("zenotravel/numeric/domain.pddl"), absolute("zenotravel/numeric/test_problem.pddl"));
+
+        auto successor_generator = p::SuccessorGenerator<p::LiftedTask>(lifted_task, ExecutionContext::create(1), storage_policy);
+        auto& state_repository = *successor_generator.get_state_repository();
+
+        EXPECT_EQ(state_repository.get_storage_policy(), storage_policy);
+
+        const auto initial_node = successor_generator.get_initial_node();
+        const auto labeled_succ_nodes = successor_generator.get_labeled_successor_nodes(initial_node);
+
+        EXPECT_EQ(labeled_succ_nodes.size(), 7);
+
+        for (const auto& labeled_succ_node : labeled_succ_nodes)
+        {
+            const auto& succ_state = labeled_succ_node.node.get_state();
+            const auto unpacked_succ_state = state_repository.get_registered_state(succ_state.get_index());
+
+            EXPECT_EQ(to_string(unpacked_succ_state), to_string(succ_state));
+        }
+    }
+}
+
+TEST(TyrTests, TyrPlanningLiftedTaskCachedHeuristic)
+{
+    auto lifted_task = compute_lifted_task(absolute("gripper/domain.pddl"), absolute("gripper/test_problem.pddl"));
+
+    auto execution_context = ExecutionContext::create(1);
+    auto successor_generator = p::SuccessorGenerator<p::LiftedTask>(lifted_task, execution_context);
+    auto ff_heuristic = p::FFRPGHeuristic<p::LiftedTask>::create(lifted_task, execution_context);
+    auto cached_heuristic = p::CachedHeuristic<p::LiftedTask>::create(lifted_task, ff_heuristic);
+
+    const auto initial_state = successor_generator.get_initial_node().get_state();
+
+    const auto h_value = ff_heuristic->evaluate(initial_state);
+    const auto preferred_actions = ff_heuristic->get_preferred_actions();
+
+    EXPECT_EQ(cached_heuristic->evaluate(initial_state), h_value);
+    EXPECT_EQ(cached_heuristic->evaluate(initial_state), h_value);
+    EXPECT_EQ(cached_heuristic->get_preferred_actions(), preferred_actions);
+    EXPECT_EQ(cached_heuristic->get_num_hits(), 1);
+    EXPECT_EQ(cached_heuristic->get_num_misses(), 1);
+}
+
+TEST(TyrTests, TyrPlanningLiftedTaskGroundActionTable)
+{
+    auto lifted_task = compute_lifted_task(absolute("blocks_3/domain.pddl"), absolute("blocks_3/test_problem.pddl"));
+
+    auto successor_generator = create_successor_generator(lifted_task);
+    const auto initial_node = successor_generator.get_initial_node();
+
+    const auto first = successor_generator.get_labeled_successor_nodes(initial_node);
+    const auto& table = successor_generator.get_ground_action_table();
+    EXPECT_EQ(table.get_num_hits(), 0);
+    EXPECT_EQ(table.get_num_misses(), table.size());
+
+    // Re-expanding the same state resolves all ground actions through the table.
+    const auto num_misses = table.get_num_misses();
+    const auto second = successor_generator.get_labeled_successor_nodes(initial_node);
+    EXPECT_EQ(table.get_num_misses(), num_misses);
+    EXPECT_EQ(table.get_num_hits(), num_misses);
+
+    ASSERT_EQ(first.size(), second.size());
+    for (size_t i = 0; i < first.size(); ++i)
+        EXPECT_EQ(first[i].label.get_index(), second[i].label.get_index());
+}
+
+TEST(TyrTests, TyrPlanningLiftedTaskAtomTranslationTable)
+{
+    auto lifted_task = compute_lifted_task(absolute("blocks_3/domain.pddl"), absolute("blocks_3/test_problem.pddl"));
+
+    auto& program = lifted_task->get_action_program();
+    auto& table = program.get_atom_translation_table();
+    auto builder = fd::Builder();
+    auto merge_context = fp::MergeDatalogContext { builder, program.get_program_context().get_workspace_repository() };
+
+    for (const auto atom : lifted_task->get_task().get_atoms<f::FluentTag>())
+    {
+        // The translation agrees with merging, and a repeated translation returns the memoized binding.
+        const auto binding = table.to_datalog(atom, merge_context).get_index();
+        const auto expected = fp::merge_p2d(atom.get_row(), merge_context).first.get_index();
+        EXPECT_EQ(binding.relation, expected.relation);
+        EXPECT_EQ(binding.row, expected.row);
+
+        const auto memoized = table.to_datalog(atom, merge_context).get_index();
+        EXPECT_EQ(memoized.relation, binding.relation);
+        EXPECT_EQ(memoized.row, binding.row);
+    }
+
+    EXPECT_GT(table.memory_usage(), 0);
+}
+
+
+TEST(TyrTests, TyrPlanningLiftedTaskRPGHeuristicActionCosts)
+{
+    auto lifted_task = compute_lifted_task(absolute("parcprinter/domain.pddl"), absolute("parcprinter/test_problem.pddl"));
+
+    const auto& program = lifted_task->get_rpg_program();
+    EXPECT_EQ(program.get_action_cost_scale(), 1);
+    EXPECT_TRUE(std::ranges::any_of(program.get_rule_action_costs(), [](auto&& cost) { return cost > 1; }));
+    EXPECT_EQ(program.get_scaled_rule_action_costs()->size(), program.get_rule_action_costs().size());
+
+    auto execution_context = ExecutionContext::create(1);
+    auto successor_generator = p::SuccessorGenerator<p::LiftedTask>(lifted_task, execution_context);
+    const auto initial_state = successor_generator.get_initial_node().get_state();
+
+    const auto h_add = p::AddRPGHeuristic<p::LiftedTask>::create(lifted_task, execution_context, true)->evaluate(initial_state);
+    const auto h_max = p::MaxRPGHeuristic<p::LiftedTask>::create(lifted_task, execution_context, true)->evaluate(initial_state);
+    const auto h_ff = p::FFRPGHeuristic<p::LiftedTask>::create(lifted_task, execution_context, true)->evaluate(initial_state);
+    const auto h_max_unit = p::MaxRPGHeuristic<p::LiftedTask>::create(lifted_task, execution_context)->evaluate(initial_state);
+
+    EXPECT_TRUE(std::isfinite(h_add));
+    EXPECT_GE(h_add, h_max);
+    EXPECT_TRUE(std::isfinite(h_ff));
+    EXPECT_GT(h_max, h_max_unit);
+}
+
+TEST(TyrTests, TyrPlanningLiftedTaskLazySuccessors)
+{
+    auto lifted_task = compute_lifted_task(absolute("gripper/domain.pddl"), absolute("gripper/test_problem.pddl"));
+
+    auto execution_context = ExecutionContext::create(1);
+    auto successor_generator = p::SuccessorGenerator<p::LiftedTask>(lifted_task, execution_context);
+    const auto initial_node = successor_generator.get_initial_node();
+
+    // Computing the applicable actions does not register successor states.
+    const auto num_states = successor_generator.get_state_repository()->get_num_states();
+    auto applicable_actions = fp::GroundActionViewList {};
+    successor_generator.get_applicable_actions(initial_node, applicable_actions);
+    EXPECT_EQ(successor_generator.get_state_repository()->get_num_states(), num_states);
+
+    const auto labeled_succ_nodes = successor_generator.get_labeled_successor_nodes(initial_node);
+    ASSERT_EQ(applicable_actions.size(), labeled_succ_nodes.size());
+    for (size_t i = 0; i < applicable_actions.size(); ++i)
+        EXPECT_EQ(applicable_actions[i].get_index(), labeled_succ_nodes[i].label.get_index());
+
+    auto ff_heuristic = p::FFRPGHeuristic<p::LiftedTask>::create(lifted_task, execution_context);
+    const auto result = p::gbfs_lazy::find_solution(*lifted_task, successor_generator, *ff_heuristic);
+
+    EXPECT_EQ(result.status, p::SearchStatus::SOLVED);
+}
+
+}
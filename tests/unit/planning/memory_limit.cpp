@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2025 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+#include <tyr/formalism/formalism.hpp>
+#include <tyr/planning/planning.hpp>
+
+namespace p = tyr::planning;
+namespace fp = tyr::formalism::planning;
+
+namespace tyr::tests
+{
+
+static fs::path absolute(const std::string& subdir) { return fs::path(std::string(DATA_DIR)) / subdir; }
+
+static p::LiftedTaskPtr compute_lifted_task()
+{
+    return p::LiftedTask::create(fp::Parser(absolute("gripper/domain.pddl")).parse_task(absolute("gripper/test_problem.pddl")));
+}
+
+template<typename Task>
+static p::SearchResult<Task> find_solution_gbfs_lazy(std::shared_ptr<Task> task, std::optional<size_t> max_memory_bytes)
+{
+    auto execution_context = ExecutionContext::create(1);
+    auto successor_generator = p::SuccessorGenerator<Task>(task, execution_context);
+    auto ff_heuristic = p::FFRPGHeuristic<Task>::create(task, execution_context);
+
+    auto options = p::gbfs_lazy::Options<Task>();
+    options.max_memory_bytes = max_memory_bytes;
+    options.memory_check_interval = 1;
+
+    auto result = p::gbfs_lazy::find_solution(*task, successor_generator, *ff_heuristic, options);
+
+    // The limit covers the task, the workspaces of the successor generator and of the heuristic.
+    EXPECT_GT(task->memory_usage(), 0);
+    EXPECT_GT(successor_generator.memory_usage(), 0);
+    EXPECT_GT(ff_heuristic->memory_usage(), 0);
+
+    return result;
+}
+
+template<typename Task>
+static p::SearchResult<Task> find_solution_astar_eager(std::shared_ptr<Task> task, std::optional<size_t> max_memory_bytes)
+{
+    auto execution_context = ExecutionContext::create(1);
+    auto successor_generator = p::SuccessorGenerator<Task>(task, execution_context);
+    auto blind_heuristic = p::BlindHeuristic<Task>::create();
+
+    auto options = p::astar_eager::Options<Task>();
+    options.max_memory_bytes = max_memory_bytes;
+    options.memory_check_interval = 1;
+
+    return p::astar_eager::find_solution(*task, successor_generator, *blind_heuristic, options);
+}
+
+TEST(TyrTests, TyrPlanningMemoryLimitGbfsLazyLifted)
+{
+    auto lifted_task = compute_lifted_task();
+
+    EXPECT_EQ(find_solution_gbfs_lazy(lifted_task, 1).status, p::SearchStatus::OUT_OF_MEMORY);
+    EXPECT_EQ(find_solution_gbfs_lazy(lifted_task, size_t(1) << 40).status, p::SearchStatus::SOLVED);
+}
+
+TEST(TyrTests, TyrPlanningMemoryLimitAstarEagerLifted)
+{
+    auto lifted_task = compute_lifted_task();
+
+    EXPECT_EQ(find_solution_astar_eager(lifted_task, 1).status, p::SearchStatus::OUT_OF_MEMORY);
+    EXPECT_EQ(find_solution_astar_eager(lifted_task, size_t(1) << 40).status, p::SearchStatus::SOLVED);
+}
+
+TEST(TyrTests, TyrPlanningMemoryLimitAstarEagerGround)
+{
+    auto lifted_task = compute_lifted_task();
+    auto execution_context = ExecutionContext::create(1);
+    auto ground_task = lifted_task->instantiate_ground_task(*execution_context);
+
+    EXPECT_GT(ground_task->memory_usage(), 0);
+    EXPECT_EQ(find_solution_astar_eager(ground_task, 1).status, p::SearchStatus::OUT_OF_MEMORY);
+    EXPECT_EQ(find_solution_astar_eager(ground_task, size_t(1) << 40).status, p::SearchStatus::SOLVED);
+}
+
+}
@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler and Simon Stahlberg
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+#include <tyr/formalism/formalism.hpp>
+#include <tyr/planning/planning.hpp>
+
+namespace p = tyr::planning;
+namespace fp = tyr::formalism::planning;
+
+namespace tyr::tests
+{
+
+static fs::path absolute(const std::string& subdir) { return fs::path(std::string(DATA_DIR)) / subdir; }
+
+TEST(TyrTests, TyrPlanningNoveltyTable)
+{
+    auto width_1 = p::NoveltyTable(1);
+
+    EXPECT_EQ(width_1.test_and_insert({ 0, 1 }), 1);
+    EXPECT_EQ(width_1.test_and_insert({ 1, 2 }), 1);
+    EXPECT_EQ(width_1.test_and_insert({ 0, 2 }), 2);
+
+    auto width_2 = p::NoveltyTable(2);
+
+    EXPECT_EQ(width_2.test_and_insert({ 0, 1 }), 1);
+    EXPECT_EQ(width_2.test_and_insert({ 1, 2 }), 1);
+    EXPECT_EQ(width_2.test_and_insert({ 0, 2 }), 2);
+    EXPECT_EQ(width_2.test_and_insert({ 2, 0 }), 3);
+    EXPECT_EQ(width_2.test_and_insert({ 0, 1, 2 }), 3);
+
+    width_2.clear();
+
+    EXPECT_EQ(width_2.test_and_insert({ 0, 1 }), 1);
+
+    EXPECT_THROW(p::NoveltyTable(3), std::runtime_error);
+}
+
+TEST(TyrTests, TyrPlanningLiftedTaskWidthBasedSearchGripper)
+{
+    auto lifted_task = p::LiftedTask::create(fp::Parser(absolute("gripper/domain.pddl")).parse_task(absolute("gripper/test_problem.pddl")));
+
+    auto execution_context = ExecutionContext::create(1);
+
+    {
+        auto successor_generator = p::SuccessorGenerator<p::LiftedTask>(lifted_task, execution_context);
+
+        const auto result = p::siw::find_solution(*lifted_task, successor_generator);
+
+        EXPECT_EQ(result.status, p::SearchStatus::SOLVED);
+    }
+
+    {
+        auto successor_generator = p::SuccessorGenerator<p::LiftedTask>(lifted_task, execution_context);
+        auto goal_count_heuristic = p::GoalCountHeuristic<p::LiftedTask>::create(lifted_task);
+
+        const auto result = p::bfws::find_solution(*lifted_task, successor_generator, *goal_count_heuristic);
+
+        EXPECT_EQ(result.status, p::SearchStatus::SOLVED);
+    }
+}
+
+}
@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2025 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+#include <limits>
+#include <string>
+#include <tyr/planning/algorithms/progress.hpp>
+#include <unistd.h>
+
+namespace tyr::tests
+{
+
+static std::string read_all(int fd)
+{
+    auto result = std::string();
+    char buffer[4096];
+    ssize_t n;
+    while ((n = ::read(fd, buffer, sizeof(buffer))) > 0)
+        result.append(buffer, static_cast<size_t>(n));
+    return result;
+}
+
+TEST(TyrTests, TyrPlanningProgressWriter)
+{
+    int fds[2];
+    ASSERT_EQ(::pipe(fds), 0);
+
+    auto probe = []
+    {
+        auto sample = planning::ProgressSample {};
+        sample.num_states = 42;
+        sample.successor_generator_time = std::chrono::milliseconds(5);
+        return sample;
+    };
+    auto writer = planning::ProgressWriter(fds[1], std::chrono::milliseconds(0), probe);
+    auto statistics = planning::Statistics();
+    statistics.increment_num_expanded();
+    statistics.increment_num_generated();
+    statistics.increment_num_generated();
+
+    writer.start();
+
+    // The clock is only read every 256 checks.
+    auto num_due = size_t(0);
+    for (size_t i = 0; i < 512; ++i)
+        num_due += writer.is_due();
+    EXPECT_EQ(num_due, 2);
+
+    writer.write("start", statistics, "best_h", std::numeric_limits<float_t>::infinity());
+    writer.write("progress", statistics, "best_h", 3);
+    ::close(fds[1]);
+
+    const auto output = read_all(fds[0]);
+    ::close(fds[0]);
+
+    const auto newline = output.find('\n');
+    ASSERT_NE(newline, std::string::npos);
+    const auto first = output.substr(0, newline);
+    const auto second = output.substr(newline + 1);
+
+    EXPECT_EQ(first.front(), '{');
+    EXPECT_EQ(first.back(), '}');
+    EXPECT_NE(first.find("\"event\":\"start\""), std::string::npos);
+    EXPECT_NE(first.find("\"expanded\":1,\"generated\":2,\"pruned\":0,\"states\":42"), std::string::npos);
+    EXPECT_NE(first.find("\"best_h\":null"), std::string::npos);
+    EXPECT_NE(first.find("\"successor_generator_ms\":5"), std::string::npos);
+
+    EXPECT_NE(second.find("\"event\":\"progress\""), std::string::npos);
+    EXPECT_NE(second.find("\"best_h\":3"), std::string::npos);
+    EXPECT_EQ(second.back(), '\n');
+}
+
+}
@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) 2025 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+#include <tyr/formalism/formalism.hpp>
+#include <tyr/planning/planning.hpp>
+
+namespace p = tyr::planning;
+namespace fp = tyr::formalism::planning;
+
+namespace tyr::tests
+{
+
+static fs::path absolute(const std::string& subdir) { return fs::path(std::string(DATA_DIR)) / subdir; }
+
+template<typename Task>
+static p::SearchResult<Task>
+find_solution(std::shared_ptr<Task> task, p::PruningStrategyPtr<Task> pruning_strategy, p::gbfs_lazy::DefaultEventHandlerPtr<Task> event_handler)
+{
+    auto execution_context = ExecutionContext::create(1);
+    auto successor_generator = p::SuccessorGenerator<Task>(task, execution_context);
+    auto ff_heuristic = p::FFRPGHeuristic<Task>::create(task, execution_context);
+
+    auto options = p::gbfs_lazy::Options<Task>();
+    options.pruning_strategy = pruning_strategy;
+    options.event_handler = event_handler;
+
+    return p::gbfs_lazy::find_solution(*task, successor_generator, *ff_heuristic, options);
+}
+
+TEST(TyrTests, TyrPlanningSymmetriesGripper)
+{
+    auto lifted_task = p::LiftedTask::create(fp::Parser(absolute("gripper/domain.pddl")).parse_task(absolute("gripper/test_problem.pddl")));
+
+    // The grippers are interchangeable, the balls are distinguished by the goal, and the rooms are constants of the domain.
+    const auto symmetries = p::ObjectSymmetries(*lifted_task);
+
+    ASSERT_EQ(symmetries.get_classes().size(), 1);
+    ASSERT_EQ(symmetries.get_classes().front().size(), 2);
+    EXPECT_EQ(symmetries.get_num_generators(), 1);
+
+    auto names = std::vector<std::string> {};
+    for (const auto object : symmetries.get_classes().front())
+        names.push_back(make_view(object, *lifted_task->get_repository()).get_name().str());
+    std::sort(names.begin(), names.end());
+    EXPECT_EQ(names, (std::vector<std::string> { "left", "right" }));
+
+    // Picking up a ball with either gripper yields symmetric successors of the initial state.
+    auto successor_generator = p::SuccessorGenerator<p::LiftedTask>(lifted_task, ExecutionContext::create(1));
+    const auto initial_node = successor_generator.get_initial_node();
+
+    auto pruning_strategy = p::SymmetryPruningStrategy<p::LiftedTask>::create(*lifted_task);
+    EXPECT_FALSE(pruning_strategy->should_prune_state(initial_node.get_state()));
+
+    auto num_pruned = size_t(0);
+    for (const auto& labeled_succ_node : successor_generator.get_labeled_successor_nodes(initial_node))
+        num_pruned += pruning_strategy->should_prune_successor_state(initial_node.get_state(), labeled_succ_node.node.get_state(), true);
+    EXPECT_GT(num_pruned, 0);
+    EXPECT_GT(pruning_strategy->memory_usage(), 0);
+
+    // The optimal plan cost.
+    auto blind_heuristic = p::BlindHeuristic<p::LiftedTask>::create();
+    const auto optimal_result = p::astar_eager::find_solution(*lifted_task, successor_generator, *blind_heuristic);
+    ASSERT_EQ(optimal_result.status, p::SearchStatus::SOLVED);
+
+    // Symmetry pruning does not preserve optimality, hence, optimal searches reject it.
+    auto astar_options = p::astar_eager::Options<p::LiftedTask>();
+    astar_options.pruning_strategy = p::SymmetryPruningStrategy<p::LiftedTask>::create(*lifted_task);
+    EXPECT_THROW(p::astar_eager::find_solution(*lifted_task, successor_generator, *blind_heuristic, astar_options), std::runtime_error);
+
+    // Satisficing search with symmetry pruning finds a plan whose cost is the number of its unit cost actions.
+    auto event_handler = p::gbfs_lazy::DefaultEventHandler<p::LiftedTask>::create();
+    auto symmetry_pruning_strategy = p::SymmetryPruningStrategy<p::LiftedTask>::create(*lifted_task);
+    const auto result = find_solution<p::LiftedTask>(lifted_task, symmetry_pruning_strategy, event_handler);
+
+    ASSERT_EQ(result.status, p::SearchStatus::SOLVED);
+    EXPECT_EQ(result.plan->get_cost(), float_t(result.plan->get_length()));
+    EXPECT_GE(result.plan->get_cost(), optimal_result.plan->get_cost());
+}
+
+}